@@ -0,0 +1,478 @@
+// dear imgui: Null Platform + Renderer Backends, for headless runs (benchmarks, tests, CI)
+// The platform backend feeds synthetic inputs at a fixed timestep, the renderer backend consumes ImDrawData without drawing.
+// Both are deterministic: the same sequence of calls produces the same frames, at thousands of frames per second.
+
+// Implemented features:
+//  [X] Platform: Fixed timestep (ImGui_ImplNullPlatform_SetDeltaTime()) and simulated time (ImGui_ImplNullPlatform_GetTime()) instead of a clock.
+//  [X] Platform: Queued mouse/keyboard/text events, applied at most one change per button/key per frame so a press and a release queued together still make a click.
+//  [X] Platform: Keyboard arrays indexed using ImGuiKey_* codes (io.KeyMap[] maps each ImGuiKey_* to itself), e.g. ImGui::IsKeyPressed(ImGuiKey_Space).
+//  [X] Platform: In-memory clipboard.
+//  [X] Renderer: Statistics of the last rendered frame (draw calls, vertices, indices, callbacks, texture uploads), see ImGui_ImplNullRenderer_GetStats().
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices (ImDrawCmd::VtxOffset), or with 32-bit indices (IMGUI_USE_32BIT_INDICES).
+//  [X] Renderer: Support for font atlas updates (ImFontAtlasFlags_DynamicGlyphs): dirty rectangles are consumed and counted as uploads.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+// Typical headless loop:
+//   ImGui_ImplNullPlatform_Init(1280, 720);
+//   ImGui_ImplNullRenderer_Init();
+//   for (int frame = 0; frame < frames; frame++)
+//   {
+//       ImGui_ImplNullPlatform_AddMousePosEvent(x, y);  // Script inputs
+//       ImGui_ImplNullRenderer_NewFrame();
+//       ImGui_ImplNullPlatform_NewFrame();
+//       ImGui::NewFrame();
+//       [...]
+//       ImGui::Render();
+//       ImGui_ImplNullRenderer_RenderDrawData(ImGui::GetDrawData());
+//   }
+
+// CHANGELOG
+// (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: Initial version.
+
+#include "imgui.h"
+#include "imgui_impl_null.h"
+#include <float.h>      // FLT_MAX
+#if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
+#include <stddef.h>     // intptr_t
+#else
+#include <stdint.h>     // intptr_t
+#endif
+
+//-----------------------------------------------------------------------------
+// Platform
+//-----------------------------------------------------------------------------
+
+enum ImGui_ImplNullPlatform_EventType
+{
+    ImGui_ImplNullPlatform_EventType_MousePos,
+    ImGui_ImplNullPlatform_EventType_MouseButton,
+    ImGui_ImplNullPlatform_EventType_MouseWheel,
+    ImGui_ImplNullPlatform_EventType_Key,
+    ImGui_ImplNullPlatform_EventType_KeyMods,
+    ImGui_ImplNullPlatform_EventType_Char
+};
+
+struct ImGui_ImplNullPlatform_Event
+{
+    ImGui_ImplNullPlatform_EventType Type;
+    int             Index;      // Mouse button, key, or modifier flags (1: Ctrl, 2: Shift, 4: Alt, 8: Super)
+    bool            Down;
+    float           X, Y;       // Mouse position or wheel
+    unsigned int    Char;
+};
+
+struct ImGui_ImplNullPlatform_Data
+{
+    ImVec2          DisplaySize;
+    ImVec2          FramebufferScale;
+    float           DeltaTime;
+    double          Time;
+    ImVector<ImGui_ImplNullPlatform_Event> Events;
+    ImVector<char>  ClipboardText;
+
+    ImGui_ImplNullPlatform_Data() { DisplaySize = ImVec2(0.0f, 0.0f); FramebufferScale = ImVec2(1.0f, 1.0f); DeltaTime = 1.0f / 60.0f; Time = 0.0; }
+};
+
+// Backend data stored in io.BackendPlatformUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplNullPlatform_Data* ImGui_ImplNullPlatform_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplNullPlatform_Data*)ImGui::GetIO().BackendPlatformUserData : NULL;
+}
+
+static const char* ImGui_ImplNullPlatform_GetClipboardText(void*)
+{
+    ImGui_ImplNullPlatform_Data* bd = ImGui_ImplNullPlatform_GetBackendData();
+    return bd->ClipboardText.Size ? bd->ClipboardText.Data : "";
+}
+
+static void ImGui_ImplNullPlatform_SetClipboardText(void*, const char* text)
+{
+    ImGui_ImplNullPlatform_Data* bd = ImGui_ImplNullPlatform_GetBackendData();
+    const int len = (int)strlen(text);
+    bd->ClipboardText.resize(len + 1);
+    memcpy(bd->ClipboardText.Data, text, (size_t)len + 1);
+}
+
+bool    ImGui_ImplNullPlatform_Init(float display_w, float display_h, float delta_time)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.BackendPlatformUserData == NULL && "Already initialized a platform backend!");
+    IM_ASSERT(delta_time > 0.0f);
+
+    // Setup backend capabilities flags
+    ImGui_ImplNullPlatform_Data* bd = IM_NEW(ImGui_ImplNullPlatform_Data)();
+    io.BackendPlatformUserData = (void*)bd;
+    io.BackendPlatformName = "imgui_impl_null";
+    io.BackendFlags |= ImGuiBackendFlags_HasSetMousePos;        // The simulated mouse follows io.WantSetMousePos requests
+    bd->DisplaySize = ImVec2(display_w, display_h);
+    bd->DeltaTime = delta_time;
+
+    // Keyboard mapping: synthetic key events use ImGuiKey_* values directly as indices into io.KeysDown[]
+    for (int key = 0; key < ImGuiKey_COUNT; key++)
+        io.KeyMap[key] = key;
+
+    io.SetClipboardTextFn = ImGui_ImplNullPlatform_SetClipboardText;
+    io.GetClipboardTextFn = ImGui_ImplNullPlatform_GetClipboardText;
+    io.ClipboardUserData = NULL;
+    io.MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
+
+    return true;
+}
+
+void    ImGui_ImplNullPlatform_Shutdown()
+{
+    ImGui_ImplNullPlatform_Data* bd = ImGui_ImplNullPlatform_GetBackendData();
+    IM_ASSERT(bd != NULL && "No platform backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    io.SetClipboardTextFn = NULL;
+    io.GetClipboardTextFn = NULL;
+    io.BackendPlatformName = NULL;
+    io.BackendPlatformUserData = NULL;
+    io.BackendFlags &= ~ImGuiBackendFlags_HasSetMousePos;
+    IM_DELETE(bd);
+}
+
+// Apply queued events, in order, until one would collide with a change already applied this frame, e.g. the release
+// of a button pressed this frame, or a mouse move following a click. The remaining events are kept for the next frames,
+// so inputs queued all at once (a click, a typed word) are seen by the application as they would with a human at the keyboard.
+static void ImGui_ImplNullPlatform_UpdateInputs()
+{
+    ImGui_ImplNullPlatform_Data* bd = ImGui_ImplNullPlatform_GetBackendData();
+    ImGuiIO& io = ImGui::GetIO();
+
+    // With io.WantSetMousePos (io.ConfigFlags & ImGuiConfigFlags_NavEnableSetMousePos), Dear ImGui already wrote the new position in io.MousePos:
+    // moving the simulated cursor has nothing more to do.
+    bool mouse_moved = false, mouse_wheeled = false, key_changed = false, text_inputted = false;
+    int mouse_button_changed = 0;
+    bool keys_changed[IM_ARRAYSIZE(io.KeysDown)] = {};
+    int event_n = 0;
+    for (; event_n < bd->Events.Size; event_n++)
+    {
+        const ImGui_ImplNullPlatform_Event& e = bd->Events[event_n];
+        if (e.Type == ImGui_ImplNullPlatform_EventType_MousePos)
+        {
+            if (mouse_button_changed != 0 || mouse_wheeled || key_changed || text_inputted)
+                break;
+            io.MousePos = ImVec2(e.X, e.Y);
+            mouse_moved = true;
+        }
+        else if (e.Type == ImGui_ImplNullPlatform_EventType_MouseButton)
+        {
+            if ((mouse_button_changed & (1 << e.Index)) || mouse_wheeled)
+                break;
+            if (io.MouseDown[e.Index] != e.Down)
+                mouse_button_changed |= 1 << e.Index;
+            io.MouseDown[e.Index] = e.Down;
+        }
+        else if (e.Type == ImGui_ImplNullPlatform_EventType_MouseWheel)
+        {
+            if (mouse_button_changed != 0)  // Unlike a move following a wheel event, a wheel event following a move applies where it should
+                break;
+            io.MouseWheelH += e.X;
+            io.MouseWheel += e.Y;
+            mouse_wheeled = true;
+        }
+        else if (e.Type == ImGui_ImplNullPlatform_EventType_Key)
+        {
+            if (io.KeysDown[e.Index] != e.Down && (keys_changed[e.Index] || text_inputted || mouse_button_changed != 0))
+                break;
+            if (io.KeysDown[e.Index] != e.Down)
+                keys_changed[e.Index] = key_changed = true;
+            io.KeysDown[e.Index] = e.Down;
+        }
+        else if (e.Type == ImGui_ImplNullPlatform_EventType_KeyMods)
+        {
+            const bool ctrl = (e.Index & 1) != 0, shift = (e.Index & 2) != 0, alt = (e.Index & 4) != 0, super = (e.Index & 8) != 0;
+            if (ctrl != io.KeyCtrl || shift != io.KeyShift || alt != io.KeyAlt || super != io.KeySuper)
+            {
+                if (text_inputted || mouse_button_changed != 0)
+                    break;
+                key_changed = true;
+            }
+            io.KeyCtrl = ctrl;
+            io.KeyShift = shift;
+            io.KeyAlt = alt;
+            io.KeySuper = super;
+        }
+        else if (e.Type == ImGui_ImplNullPlatform_EventType_Char)
+        {
+            if (key_changed || mouse_button_changed != 0 || mouse_moved || mouse_wheeled)
+                break;
+            io.AddInputCharacter(e.Char);
+            text_inputted = true;
+        }
+    }
+    if (event_n > 0)
+        bd->Events.erase(bd->Events.Data, bd->Events.Data + event_n);
+}
+
+void    ImGui_ImplNullPlatform_NewFrame()
+{
+    ImGui_ImplNullPlatform_Data* bd = ImGui_ImplNullPlatform_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullPlatform_Init()?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    // Setup display size (every frame to accommodate for window resizing)
+    io.DisplaySize = bd->DisplaySize;
+    io.DisplayFramebufferScale = bd->FramebufferScale;
+
+    // Setup time step: fixed, independent of the time spent computing the frame
+    io.DeltaTime = bd->DeltaTime;
+    bd->Time += bd->DeltaTime;
+
+    ImGui_ImplNullPlatform_UpdateInputs();
+}
+
+double  ImGui_ImplNullPlatform_GetTime()
+{
+    ImGui_ImplNullPlatform_Data* bd = ImGui_ImplNullPlatform_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullPlatform_Init()?");
+    return bd->Time;
+}
+
+void    ImGui_ImplNullPlatform_SetDeltaTime(float delta_time)
+{
+    ImGui_ImplNullPlatform_Data* bd = ImGui_ImplNullPlatform_GetBackendData();
+    IM_ASSERT(bd != NULL && delta_time > 0.0f);
+    bd->DeltaTime = delta_time;
+}
+
+void    ImGui_ImplNullPlatform_SetDisplaySize(float display_w, float display_h, float framebuffer_scale)
+{
+    ImGui_ImplNullPlatform_Data* bd = ImGui_ImplNullPlatform_GetBackendData();
+    IM_ASSERT(bd != NULL);
+    bd->DisplaySize = ImVec2(display_w, display_h);
+    bd->FramebufferScale = ImVec2(framebuffer_scale, framebuffer_scale);
+}
+
+static void ImGui_ImplNullPlatform_AddEvent(ImGui_ImplNullPlatform_EventType type, int index, bool down, float x, float y, unsigned int c)
+{
+    ImGui_ImplNullPlatform_Data* bd = ImGui_ImplNullPlatform_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullPlatform_Init()?");
+    ImGui_ImplNullPlatform_Event e;
+    e.Type = type;
+    e.Index = index;
+    e.Down = down;
+    e.X = x;
+    e.Y = y;
+    e.Char = c;
+    bd->Events.push_back(e);
+}
+
+void    ImGui_ImplNullPlatform_AddMousePosEvent(float x, float y)
+{
+    ImGui_ImplNullPlatform_AddEvent(ImGui_ImplNullPlatform_EventType_MousePos, 0, false, x, y, 0);
+}
+
+void    ImGui_ImplNullPlatform_AddMouseButtonEvent(int button, bool down)
+{
+    IM_ASSERT(button >= 0 && button < IM_ARRAYSIZE(ImGui::GetIO().MouseDown));
+    ImGui_ImplNullPlatform_AddEvent(ImGui_ImplNullPlatform_EventType_MouseButton, button, down, 0.0f, 0.0f, 0);
+}
+
+void    ImGui_ImplNullPlatform_AddMouseWheelEvent(float wheel_x, float wheel_y)
+{
+    ImGui_ImplNullPlatform_AddEvent(ImGui_ImplNullPlatform_EventType_MouseWheel, 0, false, wheel_x, wheel_y, 0);
+}
+
+void    ImGui_ImplNullPlatform_AddKeyEvent(int key, bool down)
+{
+    IM_ASSERT(key >= 0 && key < IM_ARRAYSIZE(ImGui::GetIO().KeysDown));
+    ImGui_ImplNullPlatform_AddEvent(ImGui_ImplNullPlatform_EventType_Key, key, down, 0.0f, 0.0f, 0);
+}
+
+void    ImGui_ImplNullPlatform_AddKeyModsEvent(bool ctrl, bool shift, bool alt, bool super)
+{
+    const int mods = (ctrl ? 1 : 0) | (shift ? 2 : 0) | (alt ? 4 : 0) | (super ? 8 : 0);
+    ImGui_ImplNullPlatform_AddEvent(ImGui_ImplNullPlatform_EventType_KeyMods, mods, false, 0.0f, 0.0f, 0);
+}
+
+void    ImGui_ImplNullPlatform_AddInputCharacter(unsigned int c)
+{
+    ImGui_ImplNullPlatform_AddEvent(ImGui_ImplNullPlatform_EventType_Char, 0, false, 0.0f, 0.0f, c);
+}
+
+int     ImGui_ImplNullPlatform_GetPendingEventCount()
+{
+    ImGui_ImplNullPlatform_Data* bd = ImGui_ImplNullPlatform_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullPlatform_Init()?");
+    return bd->Events.Size;
+}
+
+//-----------------------------------------------------------------------------
+// Renderer
+//-----------------------------------------------------------------------------
+
+struct ImGui_ImplNullRenderer_Data
+{
+    bool            FontTextureCreated;
+    int             FontTextureWidth;
+    int             FontTextureHeight;
+    int             PendingUploads;         // Uploads done by ImGui_ImplNullRenderer_CreateFontsTexture(), counted in the next frame statistics
+    int             PendingUploadPixels;
+    ImGui_ImplNullRenderer_Stats Stats;
+
+    ImGui_ImplNullRenderer_Data() { memset(this, 0, sizeof(*this)); }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+static ImGui_ImplNullRenderer_Data* ImGui_ImplNullRenderer_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplNullRenderer_Data*)ImGui::GetIO().BackendRendererUserData : NULL;
+}
+
+bool    ImGui_ImplNullRenderer_Init()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(io.BackendRendererUserData == NULL && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplNullRenderer_Data* bd = IM_NEW(ImGui_ImplNullRenderer_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_null";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+
+    return true;
+}
+
+void    ImGui_ImplNullRenderer_Shutdown()
+{
+    ImGui_ImplNullRenderer_Data* bd = ImGui_ImplNullRenderer_GetBackendData();
+    IM_ASSERT(bd != NULL && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImGui_ImplNullRenderer_DestroyFontsTexture();
+    io.BackendRendererName = NULL;
+    io.BackendRendererUserData = NULL;
+    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    IM_DELETE(bd);
+}
+
+void    ImGui_ImplNullRenderer_NewFrame()
+{
+    ImGui_ImplNullRenderer_Data* bd = ImGui_ImplNullRenderer_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullRenderer_Init()?");
+
+    if (!bd->FontTextureCreated)
+        ImGui_ImplNullRenderer_CreateFontsTexture();
+}
+
+// Walk the draw data the way a GPU renderer would, without drawing: consume font atlas updates, call user callbacks,
+// and count what would be submitted.
+void    ImGui_ImplNullRenderer_RenderDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplNullRenderer_Data* bd = ImGui_ImplNullRenderer_GetBackendData();
+    ImGuiIO& io = ImGui::GetIO();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullRenderer_Init()?");
+    ImGui_ImplNullRenderer_Stats& stats = bd->Stats;
+    stats = ImGui_ImplNullRenderer_Stats();
+    stats.TextureUploads = bd->PendingUploads;
+    stats.TextureUploadPixels = bd->PendingUploadPixels;
+    bd->PendingUploads = bd->PendingUploadPixels = 0;
+
+    // Avoid rendering when minimized
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (fb_width == 0 || fb_height == 0)
+        return;
+
+    // Upload glyphs rasterized during the frame
+    int x, y, w, h;
+    if (bd->FontTextureCreated && io.Fonts->GetTexDataDirtyRect(&x, &y, &w, &h))
+    {
+        if (io.Fonts->TexWidth != bd->FontTextureWidth || io.Fonts->TexHeight != bd->FontTextureHeight)
+        {
+            bd->FontTextureWidth = io.Fonts->TexWidth;
+            bd->FontTextureHeight = io.Fonts->TexHeight;
+            w = bd->FontTextureWidth;
+            h = bd->FontTextureHeight;
+        }
+        stats.TextureUploads++;
+        stats.TextureUploadPixels += w * h;
+    }
+
+    // Will project scissor/clipping rectangles into framebuffer space
+    ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+
+    // "Render" command lists
+    stats.DrawLists = draw_data->CmdListsCount;
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+    {
+        const ImDrawList* cmd_list = draw_data->CmdLists[n];
+        stats.Vertices += cmd_list->VtxBuffer.Size;
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state: we have none.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                {
+                    pcmd->UserCallback(cmd_list, pcmd);
+                    stats.Callbacks++;
+                }
+                continue;
+            }
+
+            // Project scissor/clipping rectangles into framebuffer space, skip commands a GPU renderer would skip
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y || pcmd->ElemCount == 0)
+                continue;
+            IM_ASSERT(pcmd->IdxOffset + pcmd->ElemCount <= (unsigned int)cmd_list->IdxBuffer.Size);
+            IM_ASSERT(pcmd->VtxOffset < (unsigned int)cmd_list->VtxBuffer.Size);
+            stats.DrawCalls++;
+            stats.Indices += (int)pcmd->ElemCount;
+        }
+    }
+}
+
+const ImGui_ImplNullRenderer_Stats* ImGui_ImplNullRenderer_GetStats()
+{
+    ImGui_ImplNullRenderer_Data* bd = ImGui_ImplNullRenderer_GetBackendData();
+    IM_ASSERT(bd != NULL && "Did you call ImGui_ImplNullRenderer_Init()?");
+    return &bd->Stats;
+}
+
+bool    ImGui_ImplNullRenderer_CreateFontsTexture()
+{
+    // Build texture atlas
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplNullRenderer_Data* bd = ImGui_ImplNullRenderer_GetBackendData();
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);   // Same format as most renderers, so the atlas build costs the same as with them.
+
+    // "Upload" texture
+    bd->FontTextureCreated = true;
+    bd->FontTextureWidth = width;
+    bd->FontTextureHeight = height;
+    bd->PendingUploads++;
+    bd->PendingUploadPixels += width * height;
+    io.Fonts->GetTexDataDirtyRect(NULL, NULL, NULL, NULL); // Already uploaded
+
+    // Store our identifier: any non-zero value
+    io.Fonts->SetTexID((ImTextureID)(intptr_t)1);
+
+    return true;
+}
+
+void    ImGui_ImplNullRenderer_DestroyFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplNullRenderer_Data* bd = ImGui_ImplNullRenderer_GetBackendData();
+    if (bd->FontTextureCreated)
+    {
+        io.Fonts->SetTexID(0);
+        bd->FontTextureCreated = false;
+    }
+}
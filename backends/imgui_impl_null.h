@@ -0,0 +1,59 @@
+// dear imgui: Null Platform + Renderer Backends, for headless runs (benchmarks, tests, CI)
+// The platform backend feeds synthetic inputs at a fixed timestep, the renderer backend consumes ImDrawData without drawing.
+// Both are deterministic: the same sequence of calls produces the same frames, at thousands of frames per second.
+
+// Implemented features:
+//  [X] Platform: Fixed timestep (ImGui_ImplNullPlatform_SetDeltaTime()) and simulated time (ImGui_ImplNullPlatform_GetTime()) instead of a clock.
+//  [X] Platform: Queued mouse/keyboard/text events, applied at most one change per button/key per frame so a press and a release queued together still make a click.
+//  [X] Platform: Keyboard arrays indexed using ImGuiKey_* codes (io.KeyMap[] maps each ImGuiKey_* to itself), e.g. ImGui::IsKeyPressed(ImGuiKey_Space).
+//  [X] Platform: In-memory clipboard.
+//  [X] Renderer: Statistics of the last rendered frame (draw calls, vertices, indices, callbacks, texture uploads), see ImGui_ImplNullRenderer_GetStats().
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices (ImDrawCmd::VtxOffset), or with 32-bit indices (IMGUI_USE_32BIT_INDICES).
+//  [X] Renderer: Support for font atlas updates (ImFontAtlasFlags_DynamicGlyphs): dirty rectangles are consumed and counted as uploads.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// If you are new to Dear ImGui, read documentation from the docs/ folder + read the top of imgui.cpp.
+// Read online: https://github.com/ocornut/imgui/tree/master/docs
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+
+// Platform
+IMGUI_IMPL_API bool     ImGui_ImplNullPlatform_Init(float display_w = 1280.0f, float display_h = 720.0f, float delta_time = 1.0f / 60.0f);
+IMGUI_IMPL_API void     ImGui_ImplNullPlatform_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplNullPlatform_NewFrame();
+IMGUI_IMPL_API double   ImGui_ImplNullPlatform_GetTime();                           // Simulated time: sum of the timesteps of the frames started so far. Use it instead of e.g. glfwGetTime() in code under test.
+IMGUI_IMPL_API void     ImGui_ImplNullPlatform_SetDeltaTime(float delta_time);
+IMGUI_IMPL_API void     ImGui_ImplNullPlatform_SetDisplaySize(float display_w, float display_h, float framebuffer_scale = 1.0f);
+
+// Synthetic inputs, queued and applied by the next ImGui_ImplNullPlatform_NewFrame() calls
+IMGUI_IMPL_API void     ImGui_ImplNullPlatform_AddMousePosEvent(float x, float y);   // Use -FLT_MAX,-FLT_MAX for no mouse
+IMGUI_IMPL_API void     ImGui_ImplNullPlatform_AddMouseButtonEvent(int button, bool down);
+IMGUI_IMPL_API void     ImGui_ImplNullPlatform_AddMouseWheelEvent(float wheel_x, float wheel_y);
+IMGUI_IMPL_API void     ImGui_ImplNullPlatform_AddKeyEvent(int key, bool down);     // Index into io.KeysDown[], e.g. ImGuiKey_Enter
+IMGUI_IMPL_API void     ImGui_ImplNullPlatform_AddKeyModsEvent(bool ctrl, bool shift, bool alt, bool super);
+IMGUI_IMPL_API void     ImGui_ImplNullPlatform_AddInputCharacter(unsigned int c);
+IMGUI_IMPL_API int      ImGui_ImplNullPlatform_GetPendingEventCount();              // Events queued but not applied yet
+
+// Renderer
+struct ImGui_ImplNullRenderer_Stats
+{
+    int     DrawLists;
+    int     DrawCalls;          // Non-empty commands after clipping, as a GPU renderer would issue them
+    int     Callbacks;          // User callbacks called (ImDrawCallback_ResetRenderState excluded)
+    int     Vertices;
+    int     Indices;
+    int     TextureUploads;     // Font atlas uploads (creation, resize or dirty rectangle)
+    int     TextureUploadPixels;
+};
+
+IMGUI_IMPL_API bool     ImGui_ImplNullRenderer_Init();
+IMGUI_IMPL_API void     ImGui_ImplNullRenderer_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplNullRenderer_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplNullRenderer_RenderDrawData(ImDrawData* draw_data);
+IMGUI_IMPL_API const ImGui_ImplNullRenderer_Stats* ImGui_ImplNullRenderer_GetStats(); // Last ImGui_ImplNullRenderer_RenderDrawData() call
+
+// Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplNullRenderer_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplNullRenderer_DestroyFontsTexture();
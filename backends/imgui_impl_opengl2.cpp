@@ -3,6 +3,9 @@
 
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
+//  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices (ImDrawCmd::VtxOffset), or with 32-bit indices (IMGUI_USE_32BIT_INDICES).
+//  [X] Renderer: Support for font atlas updates (ImFontAtlasFlags_DynamicGlyphs): glyphs rasterized during the frame are uploaded with glTexSubImage2D().
+//  [X] Renderer: Support for signed distance field fonts (ImFontAtlasFlags_SDF): the font texture alpha is thresholded around the glyph outline with texture combiners (OpenGL 1.3 headers).
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -19,6 +22,9 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-19: OpenGL: Threshold the font texture alpha with two GL_COMBINE texture stages when it holds signed distance fields (ImFontAtlasFlags_SDF), so text scaled up stays sharp and vertex alpha is preserved.
+//  2026-10-19: OpenGL: Upload the font atlas pixels changed during the frame (ImFontAtlas::GetTexDataDirtyRect()), and the whole texture when its size changed, to support ImFontAtlasFlags_DynamicGlyphs.
+//  2026-10-19: OpenGL: Added support for large meshes (64k+ vertices) by handling ImDrawCmd::VtxOffset (ImGuiBackendFlags_RendererHasVtxOffset). Merging consecutive draw commands sharing the same state into a single glDrawElements() call.
 //  2021-06-29: Reorganized backend to pull data from a single structure to facilitate usage with multiple-contexts (all g_XXXX access changed to bd->XXXX).
 //  2021-05-19: OpenGL: Replaced direct access to ImDrawCmd::TextureId with a call to ImDrawCmd::GetTexID(). (will become a requirement)
 //  2021-01-03: OpenGL: Backup, setup and restore GL_SHADE_MODEL state, disable GL_STENCIL_TEST and disable GL_NORMAL_ARRAY client state to increase compatibility with legacy OpenGL applications.
@@ -56,9 +62,18 @@
 #include <GL/gl.h>
 #endif
 
+// Signed distance field fonts need texture combiners and multitexturing (OpenGL 1.3).
+// The Windows SDK <GL/gl.h> only declares OpenGL 1.1: ImFontAtlasFlags_SDF textures are then drawn like regular ones, blurry when scaled up.
+#if defined(GL_VERSION_1_3)
+#define IMGUI_IMPL_OPENGL2_HAS_SDF
+#endif
+
 struct ImGui_ImplOpenGL2_Data
 {
     GLuint       FontTexture;
+    int          FontTextureWidth;
+    int          FontTextureHeight;
+    bool         FontTextureSDF;     // ImFontAtlasFlags_SDF
 
     ImGui_ImplOpenGL2_Data() { memset(this, 0, sizeof(*this)); }
 };
@@ -70,6 +85,9 @@ static ImGui_ImplOpenGL2_Data* ImGui_ImplOpenGL2_GetBackendData()
     return ImGui::GetCurrentContext() ? (ImGui_ImplOpenGL2_Data*)ImGui::GetIO().BackendRendererUserData : NULL;
 }
 
+// Forward Declarations
+static void ImGui_ImplOpenGL2_UpdateFontsTexture();
+
 // Functions
 bool    ImGui_ImplOpenGL2_Init()
 {
@@ -80,6 +98,7 @@ bool    ImGui_ImplOpenGL2_Init()
     ImGui_ImplOpenGL2_Data* bd = IM_NEW(ImGui_ImplOpenGL2_Data)();
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_opengl2";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
 
     return true;
 }
@@ -93,6 +112,7 @@ void    ImGui_ImplOpenGL2_Shutdown()
     ImGui_ImplOpenGL2_DestroyDeviceObjects();
     io.BackendRendererName = NULL;
     io.BackendRendererUserData = NULL;
+    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
     IM_DELETE(bd);
 }
 
@@ -105,6 +125,51 @@ void    ImGui_ImplOpenGL2_NewFrame()
         ImGui_ImplOpenGL2_CreateDeviceObjects();
 }
 
+#ifdef IMGUI_IMPL_OPENGL2_HAS_SDF
+// Signed distance field font texture (ImFontAtlasFlags_SDF): the glyph outline is where the texture alpha crosses 0.5.
+// - Stage 0: RGB = texture * vertex color, alpha = (texture - 0.375) * 4, a steep ramp centered on the outline which stays anti-aliased.
+//   The white pixel (alpha 1.0) stays opaque, so shapes keep their anti-aliased fringes, which are made of vertex alpha.
+// - Stage 1: alpha = stage 0 * vertex alpha. It needs a complete texture bound to be enabled: we bind the font texture and ignore it.
+// Both stages are set up here, ImGui_ImplOpenGL2_EnableSDFTextureStages() switches them on for draw commands using the font texture.
+static void ImGui_ImplOpenGL2_SetupSDFTextureStages(GLuint font_texture)
+{
+    const GLfloat threshold[4] = { 0.0f, 0.0f, 0.0f, 0.375f };
+    glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_MODULATE);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_TEXTURE);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_RGB, GL_PRIMARY_COLOR);
+    glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA, GL_SUBTRACT);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_ALPHA, GL_TEXTURE);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_ALPHA, GL_CONSTANT);
+    glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, threshold);
+    glTexEnvf(GL_TEXTURE_ENV, GL_ALPHA_SCALE, 4.0f);
+
+    glActiveTexture(GL_TEXTURE1);
+    glDisable(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, font_texture);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_COMBINE);
+    glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_RGB, GL_REPLACE);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_RGB, GL_PREVIOUS);
+    glTexEnvi(GL_TEXTURE_ENV, GL_COMBINE_ALPHA, GL_MODULATE);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE0_ALPHA, GL_PREVIOUS);
+    glTexEnvi(GL_TEXTURE_ENV, GL_SOURCE1_ALPHA, GL_PRIMARY_COLOR);
+    glActiveTexture(GL_TEXTURE0);
+}
+
+static void ImGui_ImplOpenGL2_EnableSDFTextureStages(bool enable)
+{
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, enable ? GL_COMBINE : GL_MODULATE);
+    glActiveTexture(GL_TEXTURE1);
+    if (enable)
+        glEnable(GL_TEXTURE_2D);
+    else
+        glDisable(GL_TEXTURE_2D);
+    glActiveTexture(GL_TEXTURE0);
+}
+#else
+static void ImGui_ImplOpenGL2_SetupSDFTextureStages(GLuint) {}
+static void ImGui_ImplOpenGL2_EnableSDFTextureStages(bool) {}
+#endif
+
 static void ImGui_ImplOpenGL2_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height)
 {
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, vertex/texcoord/color pointers, polygon fill.
@@ -125,6 +190,9 @@ static void ImGui_ImplOpenGL2_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
     glShadeModel(GL_SMOOTH);
     glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    if (bd->FontTextureSDF)
+        ImGui_ImplOpenGL2_SetupSDFTextureStages(bd->FontTexture);
 
     // If you are using this code with non-legacy OpenGL header/contexts (which you should not, prefer using imgui_impl_opengl3.cpp!!),
     // you may need to backup/reset/restore other state, e.g. for current shader using the commented lines below.
@@ -160,6 +228,10 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     if (fb_width == 0 || fb_height == 0)
         return;
 
+    // Upload glyphs rasterized during the frame
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    ImGui_ImplOpenGL2_UpdateFontsTexture();
+
     // Backup GL state
     GLint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
     GLint last_polygon_mode[2]; glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode);
@@ -167,7 +239,7 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     GLint last_scissor_box[4]; glGetIntegerv(GL_SCISSOR_BOX, last_scissor_box);
     GLint last_shade_model; glGetIntegerv(GL_SHADE_MODEL, &last_shade_model);
     GLint last_tex_env_mode; glGetTexEnviv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, &last_tex_env_mode);
-    glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TRANSFORM_BIT);
+    glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TRANSFORM_BIT | (bd->FontTextureSDF ? GL_TEXTURE_BIT : 0)); // GL_TEXTURE_BIT: texture stages setup for ImFontAtlasFlags_SDF
 
     // Setup desired GL state
     ImGui_ImplOpenGL2_SetupRenderState(draw_data, fb_width, fb_height);
@@ -177,26 +249,40 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
     // Render command lists
+    bool sdf_stages = false; // ImGui_ImplOpenGL2_EnableSDFTextureStages() state
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
-        const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data;
         const ImDrawIdx* idx_buffer = cmd_list->IdxBuffer.Data;
-        glVertexPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, pos)));
-        glTexCoordPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, uv)));
-        glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, col)));
+        unsigned int vtx_offset = (unsigned int)-1;
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
             const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+
+            // Merge the following commands if they share the same state and their indices are contiguous, and draw them with a single glDrawElements() call.
+            // ImDrawList already merges most of them while recording, but not all (e.g. after ImDrawList::AddDrawCmd() or channels merging).
+            unsigned int elem_count = pcmd->ElemCount;
+            while (!pcmd->UserCallback && cmd_i + 1 < cmd_list->CmdBuffer.Size)
+            {
+                const ImDrawCmd* next_cmd = &cmd_list->CmdBuffer[cmd_i + 1];
+                if (next_cmd->UserCallback || next_cmd->VtxOffset != pcmd->VtxOffset || next_cmd->IdxOffset != pcmd->IdxOffset + elem_count || next_cmd->GetTexID() != pcmd->GetTexID() || memcmp(&next_cmd->ClipRect, &pcmd->ClipRect, sizeof(ImVec4)) != 0)
+                    break;
+                elem_count += next_cmd->ElemCount;
+                cmd_i++;
+            }
             if (pcmd->UserCallback)
             {
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
                     ImGui_ImplOpenGL2_SetupRenderState(draw_data, fb_width, fb_height);
+                    sdf_stages = false;
+                }
                 else
                     pcmd->UserCallback(cmd_list, pcmd);
+                vtx_offset = (unsigned int)-1; // Callback may have modified the vertex arrays
             }
             else
             {
@@ -209,11 +295,26 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
                 glScissor((int)clip_min.x, (int)(fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y));
 
+                // Setup vertex arrays (GL2 has no base vertex parameter, offset the pointers instead)
+                if (pcmd->VtxOffset != vtx_offset)
+                {
+                    vtx_offset = pcmd->VtxOffset;
+                    const ImDrawVert* vtx_buffer = cmd_list->VtxBuffer.Data + vtx_offset;
+                    glVertexPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, pos)));
+                    glTexCoordPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, uv)));
+                    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + IM_OFFSETOF(ImDrawVert, col)));
+                }
+
                 // Bind texture, Draw
-                glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID());
-                glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer);
+                const GLuint texture = (GLuint)(intptr_t)pcmd->GetTexID();
+                if (bd->FontTextureSDF && sdf_stages != (texture == bd->FontTexture))
+                {
+                    sdf_stages = !sdf_stages;
+                    ImGui_ImplOpenGL2_EnableSDFTextureStages(sdf_stages);
+                }
+                glBindTexture(GL_TEXTURE_2D, texture);
+                glDrawElements(GL_TRIANGLES, (GLsizei)elem_count, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer + pcmd->IdxOffset);
             }
-            idx_buffer += pcmd->ElemCount;
         }
     }
 
@@ -252,6 +353,12 @@ bool ImGui_ImplOpenGL2_CreateFontsTexture()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    bd->FontTextureWidth = width;
+    bd->FontTextureHeight = height;
+#ifdef IMGUI_IMPL_OPENGL2_HAS_SDF
+    bd->FontTextureSDF = (io.Fonts->Flags & ImFontAtlasFlags_SDF) != 0;
+#endif
+    io.Fonts->GetTexDataDirtyRect(NULL, NULL, NULL, NULL); // Already uploaded
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
@@ -262,6 +369,37 @@ bool ImGui_ImplOpenGL2_CreateFontsTexture()
     return true;
 }
 
+// Upload the pixels changed since the last upload (ImFontAtlasFlags_DynamicGlyphs), or the whole texture if it was resized.
+static void ImGui_ImplOpenGL2_UpdateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    int x, y, w, h;
+    if (!bd->FontTexture || !io.Fonts->GetTexDataDirtyRect(&x, &y, &w, &h))
+        return;
+
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    GLint last_texture;
+    glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    glBindTexture(GL_TEXTURE_2D, bd->FontTexture);
+    if (width != bd->FontTextureWidth || height != bd->FontTextureHeight)
+    {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        bd->FontTextureWidth = width;
+        bd->FontTextureHeight = height;
+    }
+    else
+    {
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, GL_RGBA, GL_UNSIGNED_BYTE, pixels + ((size_t)y * width + x) * 4);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    }
+    glBindTexture(GL_TEXTURE_2D, last_texture);
+}
+
 void ImGui_ImplOpenGL2_DestroyFontsTexture()
 {
     ImGuiIO& io = ImGui::GetIO();
@@ -0,0 +1,202 @@
+/*
+* Variable height list clipper benchmark (ImGuiVariableListClipper): a log view mixing single-line
+* and wrapped multi-line items, scrolled to the top, middle and bottom of lists of up to 10M items.
+*
+* Usage:
+*   bench_clipper          run timings, and the memory used by the clipper after its first frame
+*   bench_clipper check    compare clipped frames with frames submitting every item
+*/
+#include "bench_common.h"
+
+static const char* paragraph =
+	"Dear ImGui is a bloat-free graphical user interface library for C++. It outputs optimized vertex buffers "
+	"that you can render anytime in your 3D-pipeline enabled application. It is fast, portable, renderer agnostic "
+	"and self-contained (no external dependencies).";
+
+enum { MODE_ALL, MODE_CLIPPER };
+
+static ImGuiVariableListClipper* clipper;
+
+/* Every 7th item is a wrapped paragraph, every 5th has two lines */
+static void submit_item(int i)
+{
+	if (i % 7 == 0)
+		ImGui::TextWrapped("%d %s", i, paragraph);
+	else if (i % 5 == 0)
+		ImGui::Text("%d Event with details\n  source: device %d", i, i % 13);
+	else
+		ImGui::Text("%d Event", i);
+}
+
+static void submit_row(int i)
+{
+	ImGui::TableNextRow();
+	ImGui::TableNextColumn();
+	ImGui::Text("%d", i);
+	ImGui::TableNextColumn();
+	submit_item(i);
+}
+
+static void list_frame(int mode, int items_count, bool table, float scroll_y)
+{
+	ImGui::NewFrame();
+	if (ImGuiWindow* window = ImGui::FindWindowByName("List"))
+		ImGui::SetScrollY(window, scroll_y);
+	ImGui::SetNextWindowPos(ImVec2(0, 0));
+	ImGui::SetNextWindowSize(ImVec2(640, 720));
+	ImGui::Begin("List", NULL, ImGuiWindowFlags_NoSavedSettings);
+	if (table)
+		ImGui::BeginTable("table", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerH);
+	if (mode == MODE_ALL) {
+		for (int i = 0; i < items_count; i++)
+			table ? submit_row(i) : submit_item(i);
+	} else {
+		clipper->Begin(items_count);
+		while (clipper->Step())
+			for (int i = clipper->DisplayStart; i < clipper->DisplayEnd; i++)
+				table ? submit_row(i) : submit_item(i);
+	}
+	if (table)
+		ImGui::EndTable();
+	ImGui::End();
+	ImGui::Render();
+}
+
+static float list_scroll_max()
+{
+	return ImGui::FindWindowByName("List")->ScrollMax.y;
+}
+
+/* Flatten the draw data of the last frame */
+static void capture(ImVector<ImDrawVert>& vtx)
+{
+	vtx.resize(0);
+	ImDrawData* draw_data = ImGui::GetDrawData();
+	for (int n = 0; n < draw_data->CmdListsCount; n++) {
+		const ImDrawList* list = draw_data->CmdLists[n];
+		for (int i = 0; i < list->VtxBuffer.Size; i++)
+			vtx.push_back(list->VtxBuffer[i]);
+	}
+}
+
+static int compare(const ImVector<ImDrawVert>& vtx, const ImVector<ImDrawVert>& ref_vtx)
+{
+	if (vtx.Size != ref_vtx.Size)
+		return 1;
+	int mismatches = 0;
+	for (int i = 0; i < vtx.Size; i++)
+		if (ImFabs(vtx[i].pos.x - ref_vtx[i].pos.x) > 0.1f || ImFabs(vtx[i].pos.y - ref_vtx[i].pos.y) > 0.1f ||
+			vtx[i].uv.x != ref_vtx[i].uv.x || vtx[i].uv.y != ref_vtx[i].uv.y || vtx[i].col != ref_vtx[i].col)
+			mismatches++;
+	return mismatches;
+}
+
+/*
+* Scroll through the whole list page by page so every item gets measured, then compare
+* frames at several positions with frames submitting every item: same scroll range, same vertices.
+* Like ImGuiListClipper, seeking past the last item includes its trailing spacing, so the scroll range
+* and the scrollbar grab may be a few pixels off while the last item is not visible.
+*/
+static int run_check()
+{
+	const int items_count = 3000;
+	int errors = 0;
+	for (int table = 0; table < 2; table++) {
+		ImGuiVariableListClipper list_clipper;
+		clipper = &list_clipper;
+		float scroll_max = 0.0f;
+		int pages = 0;
+		for (float y = 0.0f; y <= scroll_max + 720.0f; y += 600.0f, pages++) {
+			list_frame(MODE_CLIPPER, items_count, table != 0, y);
+			scroll_max = list_scroll_max();
+		}
+		list_frame(MODE_CLIPPER, items_count, table != 0, 0.0f);
+		const int measured = list_clipper.MeasuredCount;
+		list_frame(MODE_ALL, items_count, table != 0, 0.0f);
+		list_frame(MODE_ALL, items_count, table != 0, 0.0f);
+		const float ref_scroll_max = list_scroll_max();
+		int mismatches = (measured != items_count || ImFabs(scroll_max - ref_scroll_max) > 8.0f) ? 1 : 0;
+		const float positions[] = { 0.0f, 1234.5f, ref_scroll_max * 0.5f, ref_scroll_max - 100.0f, ref_scroll_max };
+		for (int p = 0; p < IM_ARRAYSIZE(positions); p++) {
+			ImVector<ImDrawVert> ref_vtx, vtx;
+			for (int i = 0; i < 2; i++)
+				list_frame(MODE_ALL, items_count, table != 0, positions[p]);
+			capture(ref_vtx);
+			for (int i = 0; i < 2; i++)
+				list_frame(MODE_CLIPPER, items_count, table != 0, positions[p]);
+			capture(vtx);
+			mismatches += compare(vtx, ref_vtx);
+		}
+		printf("check/%-6s %d items measured in %d pages, scroll max %.1f (all items %.1f) %s\n", table ? "table" : "window",
+			measured, pages, scroll_max, ref_scroll_max, mismatches ? "FAIL" : "OK");
+		errors += mismatches;
+		clipper = NULL;
+	}
+	return errors ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+	static ImGuiAllocTracker alloc_tracker;
+	ImGui::InstallAllocTracker(&alloc_tracker);
+	bench_create_context();
+
+	if (argc == 2 && strcmp(argv[1], "check") == 0) {
+		int ret = run_check();
+		ImGui::DestroyContext();
+		return ret;
+	}
+
+	char name[64];
+	const int iterations = 1000;
+
+	/* Reference: submitting every item, only usable for small lists */
+	for (int table = 0; table < 2; table++) {
+		const int items_count = 10000;
+		for (int i = 0; i < 3; i++)
+			list_frame(MODE_ALL, items_count, table != 0, 0.0f);
+		double t0 = bench_time();
+		for (int i = 0; i < 20; i++)
+			list_frame(MODE_ALL, items_count, table != 0, 0.0f);
+		snprintf(name, sizeof(name), "%s/all/10k", table ? "table" : "window");
+		bench_report(name, 20, bench_time() - t0);
+	}
+
+	const int counts[] = { 10000, 1000000, 10000000 };
+	const char* count_names[] = { "10k", "1M", "10M" };
+	for (int table = 0; table < 2; table++)
+		for (int c = 0; c < IM_ARRAYSIZE(counts); c++) {
+			ImGuiVariableListClipper list_clipper;
+			clipper = &list_clipper;
+			const size_t active_bytes = alloc_tracker.Total.ActiveBytes;
+			double t0 = bench_time();
+			list_frame(MODE_CLIPPER, counts[c], table != 0, 0.0f);
+			snprintf(name, sizeof(name), "%s/clipper/%s/first_frame", table ? "table" : "window", count_names[c]);
+			bench_report(name, 1, bench_time() - t0);
+			printf("%-40s %10.3f MB allocated\n", "", (double)(alloc_tracker.Total.ActiveBytes - active_bytes) / (1024 * 1024));
+
+			const float fractions[] = { 0.0f, 0.5f, 1.0f };
+			const char* fraction_names[] = { "top", "middle", "bottom" };
+			for (int f = 0; f < IM_ARRAYSIZE(fractions); f++) {
+				for (int i = 0; i < 3; i++)
+					list_frame(MODE_CLIPPER, counts[c], table != 0, list_scroll_max() * fractions[f]);
+				const float scroll_y = list_scroll_max() * fractions[f];
+				t0 = bench_time();
+				for (int i = 0; i < iterations; i++)
+					list_frame(MODE_CLIPPER, counts[c], table != 0, scroll_y);
+				snprintf(name, sizeof(name), "%s/clipper/%s/%s", table ? "table" : "window", count_names[c], fraction_names[f]);
+				bench_report(name, iterations, bench_time() - t0);
+			}
+
+			/* Scrolling: a new page every frame, measuring new items */
+			t0 = bench_time();
+			for (int i = 0; i < iterations; i++)
+				list_frame(MODE_CLIPPER, counts[c], table != 0, 600.0f * i);
+			snprintf(name, sizeof(name), "%s/clipper/%s/scrolling", table ? "table" : "window", count_names[c]);
+			bench_report(name, iterations, bench_time() - t0);
+			clipper = NULL;
+		}
+
+	ImGui::DestroyContext();
+	return 0;
+}
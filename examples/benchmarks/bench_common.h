@@ -0,0 +1,51 @@
+/*
+* Headless benchmark helpers
+* No platform/renderer backend: the draw data is built but never rendered.
+*/
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#define IMGUI_DEFINE_MATH_OPERATORS
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+static inline double bench_time()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/*
+* Create a context with a built font atlas and a fixed display size,
+* so NewFrame()/Render() can run without any backend.
+*/
+static inline ImGuiContext* bench_create_context(float width = 1280.0f, float height = 720.0f)
+{
+	ImGuiContext* ctx = ImGui::CreateContext();
+	ImGuiIO& io = ImGui::GetIO();
+	io.IniFilename = NULL;
+	io.DisplaySize = ImVec2(width, height);
+	io.DeltaTime = 1.0f / 60.0f;
+	io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+	unsigned char* pixels;
+	int tex_w, tex_h;
+	io.Fonts->GetTexDataAsRGBA32(&pixels, &tex_w, &tex_h);
+	io.Fonts->SetTexID((ImTextureID)(intptr_t)1);
+	return ctx;
+}
+
+/*
+* Print one result line, same format for every benchmark:
+* <name> <iterations> <total ms> <us per iteration>
+*/
+static inline void bench_report(const char* name, int iterations, double seconds)
+{
+	printf("%-40s %8d iters %10.3f ms %10.3f us/iter\n", name, iterations, seconds * 1e3, seconds * 1e6 / iterations);
+}
+
+#endif
@@ -0,0 +1,157 @@
+/*
+* Threaded draw list recording benchmark (PrepareDrawList()/SubmitDrawList()): a window showing plot-like panels
+* of circles, lines, polylines and text, recorded into the window draw list, or one panel per worker thread into
+* user-owned draw lists submitted after the window contents.
+*
+* Usage:
+*   bench_draw_threads          run timings
+*   bench_draw_threads check    compare the geometry of frames recorded on worker threads with frames recorded inline
+*/
+#include "bench_common.h"
+#include <math.h>
+#include <thread>
+
+#define NUM_PANELS 4
+#define PANEL_W 480.0f
+#define PANEL_H 270.0f
+
+static void panel_contents(ImDrawList* draw_list, int panel, int points, float phase)
+{
+	const ImVec2 origin(20.0f + (panel % 2) * (PANEL_W + 20.0f), 40.0f + (panel / 2) * (PANEL_H + 20.0f));
+	draw_list->AddRect(origin, origin + ImVec2(PANEL_W, PANEL_H), IM_COL32(255, 255, 255, 128));
+
+	/* Scatter plot */
+	for (int i = 0; i < points; i++) {
+		const float t = (float)i / points;
+		const ImVec2 p = origin + ImVec2(t * PANEL_W, PANEL_H * (0.5f + 0.4f * sinf(t * 40.0f + phase + panel)));
+		draw_list->AddCircleFilled(p, 2.0f + (i % 3), IM_COL32(255, 64 * panel, 128, 200), 8);
+	}
+
+	/* Line plot: polyline and segments */
+	ImVec2 line[256];
+	for (int i = 0; i < IM_ARRAYSIZE(line); i++) {
+		const float t = (float)i / (IM_ARRAYSIZE(line) - 1);
+		line[i] = origin + ImVec2(t * PANEL_W, PANEL_H * (0.5f + 0.3f * cosf(t * 12.0f + phase)));
+	}
+	draw_list->AddPolyline(line, IM_ARRAYSIZE(line), IM_COL32(64, 255, 64, 255), ImDrawFlags_None, 1.5f);
+	for (int i = 0; i < IM_ARRAYSIZE(line); i += 8)
+		draw_list->AddLine(ImVec2(line[i].x, origin.y + PANEL_H), line[i], IM_COL32(64, 128, 255, 160));
+
+	/* Labels */
+	char label[32];
+	for (int i = 0; i <= 10; i++) {
+		snprintf(label, sizeof(label), "%.2f", phase + i * 0.1f);
+		draw_list->AddText(origin + ImVec2(i * PANEL_W / 10.0f, PANEL_H - 16.0f), IM_COL32_WHITE, label);
+	}
+}
+
+/* One draw list per worker thread, kept alive until the draw data is rendered (here: replaced by the next frame) */
+static ImDrawList* lists[NUM_PANELS];
+static ImDrawListSharedData shared_data[NUM_PANELS];
+
+static void plot_frame(bool threaded, int points, float phase)
+{
+	ImGui::NewFrame();
+	ImGui::SetNextWindowPos(ImVec2(0, 0));
+	ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+	ImGui::Begin("Plots", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoDecoration);
+	ImGui::Text("%d points per panel", points);
+	if (threaded) {
+		std::thread workers[NUM_PANELS];
+		for (int panel = 0; panel < NUM_PANELS; panel++) {
+			if (lists[panel] == NULL)
+				lists[panel] = IM_NEW(ImDrawList)(NULL);
+			ImGui::PrepareDrawList(lists[panel], &shared_data[panel]);
+			workers[panel] = std::thread(panel_contents, lists[panel], panel, points, phase);
+		}
+		for (int panel = 0; panel < NUM_PANELS; panel++) {
+			workers[panel].join();
+			ImGui::SubmitDrawList(lists[panel]);
+		}
+	}
+	else {
+		for (int panel = 0; panel < NUM_PANELS; panel++)
+			panel_contents(ImGui::GetWindowDrawList(), panel, points, phase);
+	}
+	ImGui::End();
+	ImGui::Render();
+}
+
+/* Visible geometry in draw order: each triangle with its vertices, clipping rectangle and texture, regardless of draw list and command boundaries */
+struct draw_triangle {
+	ImDrawVert vtx[3];
+	ImVec4 clip_rect;
+	ImTextureID texture;
+};
+
+static void capture(ImVector<draw_triangle>& triangles)
+{
+	triangles.resize(0);
+	ImDrawData* draw_data = ImGui::GetDrawData();
+	for (int n = 0; n < draw_data->CmdListsCount; n++) {
+		const ImDrawList* list = draw_data->CmdLists[n];
+		for (int cmd_n = 0; cmd_n < list->CmdBuffer.Size; cmd_n++) {
+			const ImDrawCmd* cmd = &list->CmdBuffer[cmd_n];
+			for (unsigned int i = 0; i + 2 < cmd->ElemCount; i += 3) {
+				draw_triangle t;
+				memset((void*)&t, 0, sizeof(t));
+				for (int v = 0; v < 3; v++)
+					t.vtx[v] = list->VtxBuffer[cmd->VtxOffset + list->IdxBuffer[cmd->IdxOffset + i + v]];
+				t.clip_rect = cmd->ClipRect;
+				t.texture = cmd->TextureId;
+				triangles.push_back(t);
+			}
+		}
+	}
+}
+
+static int run_check()
+{
+	const int points_list[] = { 100, 20000 };
+	ImVector<draw_triangle> triangles[2];
+	int mismatches = 0, frames = 0;
+	for (int p = 0; p < IM_ARRAYSIZE(points_list); p++)
+		for (int frame = 0; frame < 3; frame++) {
+			for (int threaded = 0; threaded < 2; threaded++) {
+				plot_frame(threaded != 0, points_list[p], frame * 0.25f);
+				capture(triangles[threaded]);
+			}
+			if (triangles[0].Size == 0 || triangles[0].Size != triangles[1].Size || memcmp(triangles[0].Data, triangles[1].Data, (size_t)triangles[0].size_in_bytes()) != 0)
+				mismatches++;
+			frames++;
+		}
+	const bool ok = (mismatches == 0);
+	printf("check/threads  %d frames, %d panels on worker threads, %d mismatches %s\n", frames, NUM_PANELS, mismatches, ok ? "OK" : "FAIL");
+	return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+	bench_create_context(1280.0f, 720.0f);
+
+	if (argc == 2 && strcmp(argv[1], "check") == 0) {
+		int ret = run_check();
+		for (int panel = 0; panel < NUM_PANELS; panel++)
+			IM_DELETE(lists[panel]);
+		ImGui::DestroyContext();
+		return ret;
+	}
+
+	const int iterations = 50;
+	const int points_list[] = { 1000, 10000, 50000 };
+	char name[64];
+	for (int p = 0; p < IM_ARRAYSIZE(points_list); p++)
+		for (int threaded = 0; threaded < 2; threaded++) {
+			plot_frame(threaded != 0, points_list[p], 0.0f);
+			double t0 = bench_time();
+			for (int i = 0; i < iterations; i++)
+				plot_frame(threaded != 0, points_list[p], i * 0.01f);
+			snprintf(name, sizeof(name), "frame/%d_points/%s", points_list[p], threaded ? "threads" : "inline");
+			bench_report(name, iterations, bench_time() - t0);
+		}
+
+	for (int panel = 0; panel < NUM_PANELS; panel++)
+		IM_DELETE(lists[panel]);
+	ImGui::DestroyContext();
+	return 0;
+}
@@ -0,0 +1,208 @@
+/*
+* Event recognizer of the GLFW example (examples/example_glfw_opengl2/EventRecognizer.cpp), run headless: low level
+* events are queued to Dear ImGui through the null platform backend (imgui_impl_null.cpp) and forwarded to the
+* recognizer at the same time, as the GLFW callbacks of the example do.
+*
+* Usage:
+*   bench_events          run timings
+*   bench_events check    play a scripted event sequence over a window with a text field, and compare the higher level
+*                         events with the expected ones (clicks, keypresses, events captured by Dear ImGui)
+*/
+#include "bench_common.h"
+#include "imgui_impl_null.h"
+#include "EventRecognizer.h"
+
+/* One low level event: 'p' = mouse position, 'b' = mouse button, 'k' = key (ImGuiKey_* code) */
+struct script_event {
+	int frame;
+	char what;
+	int code;
+	bool down;
+	float x, y;
+};
+
+/* Higher level event expected from the recognizer */
+struct expected_event {
+	char what;
+	int type;       /* Mouse: 0 = button, 1 = move */
+	int action;     /* EVENT_RELEASE, EVENT_PRESS, EVENT_CLICK */
+	int code;       /* Mouse button or key */
+	float x, y;
+};
+
+/* The text field is at (20,40)-(150,59) in the window at (0,0)-(200,150) */
+static const script_event script[] = {
+	{   5, 'p', 0, false, 400.0f, 300.0f },    /* Move outside the window */
+	{  40, 'b', 0, true },                      /* Left click */
+	{  45, 'b', 0, false },
+	{  80, 'k', ImGuiKey_A, true },             /* Key held longer than KEY_TIME: press and release */
+	{ 120, 'k', ImGuiKey_A, false },
+	{ 160, 'p', 0, false, 60.0f, 48.0f },       /* Move over the text field, captured from the next frame */
+	{ 200, 'b', 0, true },                      /* Click in the text field, keyboard captured while it is active */
+	{ 202, 'b', 0, false },
+	{ 220, 'k', ImGuiKey_A, true },
+	{ 222, 'k', ImGuiKey_A, false },
+	{ 240, 'k', ImGuiKey_Escape, true },        /* Deactivate the text field, the release isn't captured anymore */
+	{ 242, 'k', ImGuiKey_Escape, false },
+	{ 260, 'p', 0, false, 400.0f, 300.0f },     /* Leave the window, the move itself is still captured */
+	{ 280, 'b', 1, true },                      /* Right click */
+	{ 283, 'b', 1, false },
+	{ 320, 'k', ImGuiKey_C, true },             /* Keypress */
+	{ 330, 'k', ImGuiKey_C, false },
+};
+
+static const expected_event expected[] = {
+	{ 'm', 1, EVENT_RELEASE, 0, 400.0f, 300.0f },
+	{ 'm', 0, EVENT_CLICK, 0 },
+	{ 'k', 0, EVENT_PRESS, ImGuiKey_A },
+	{ 'k', 0, EVENT_RELEASE, ImGuiKey_A },
+	{ 'm', 1, EVENT_RELEASE, 0, 60.0f, 48.0f },
+	{ 'k', 0, EVENT_RELEASE, ImGuiKey_Escape },
+	{ 'm', 0, EVENT_CLICK, 1 },
+	{ 'k', 0, EVENT_CLICK, ImGuiKey_C },
+};
+
+static void create_context()
+{
+	ImGui::CreateContext();
+	ImGui::GetIO().IniFilename = NULL;
+	ImGui_ImplNullPlatform_Init(640.0f, 480.0f);
+	ImGui_ImplNullRenderer_Init();
+}
+
+static void destroy_context()
+{
+	ImGui_ImplNullRenderer_Shutdown();
+	ImGui_ImplNullPlatform_Shutdown();
+	ImGui::DestroyContext();
+}
+
+/* Queue the events of a frame to Dear ImGui and to the recognizer, which sees the capture flags of the last frame */
+static void queue_events(EventRecognizer* recognizer, int frame)
+{
+	const double time = ImGui_ImplNullPlatform_GetTime();
+	for (int n = 0; n < IM_ARRAYSIZE(script); n++) {
+		const script_event* e = &script[n];
+		if (e->frame != frame)
+			continue;
+		const int action = e->down ? EVENT_PRESS : EVENT_RELEASE;
+		if (e->what == 'p') {
+			ImGui_ImplNullPlatform_AddMousePosEvent(e->x, e->y);
+			recognizer->add_mouse_move(time, e->x, e->y);
+		}
+		else if (e->what == 'b') {
+			ImGui_ImplNullPlatform_AddMouseButtonEvent(e->code, e->down);
+			recognizer->add_mouse_button(time, e->code, action, 0);
+		}
+		else {
+			ImGui_ImplNullPlatform_AddKeyEvent(e->code, e->down);
+			recognizer->add_key(time, e->code, action, 0);
+		}
+	}
+}
+
+/* One frame of the window with the text field, return true when the text field is active */
+static bool ui_frame(char* buf, int buf_size)
+{
+	ImGui_ImplNullRenderer_NewFrame();
+	ImGui_ImplNullPlatform_NewFrame();
+	ImGui::NewFrame();
+	ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+	ImGui::SetNextWindowSize(ImVec2(200.0f, 150.0f));
+	ImGui::Begin("Panel", NULL, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoSavedSettings);
+	ImGui::SetCursorScreenPos(ImVec2(20.0f, 40.0f));
+	ImGui::SetNextItemWidth(130.0f);
+	ImGui::InputText("##text", buf, (size_t)buf_size);
+	const bool active = ImGui::IsItemActive();
+	ImGui::End();
+	ImGui::Render();
+	ImGui_ImplNullRenderer_RenderDrawData(ImGui::GetDrawData());
+	return active;
+}
+
+static int run_check()
+{
+	create_context();
+	EventRecognizer recognizer;
+	ImVector<t_event> events;
+	char buf[16] = "";
+	int active_frames = 0;
+	bool active = false;
+	for (int frame = 0; frame < 400; frame++) {
+		queue_events(&recognizer, frame);
+		active = ui_frame(buf, IM_ARRAYSIZE(buf));
+		if (active)
+			active_frames++;
+		recognizer.process(ImGui_ImplNullPlatform_GetTime());
+		t_event event;
+		while (recognizer.next(event))
+			events.push_back(event);
+	}
+	destroy_context();
+
+	int mismatches = 0;
+	for (int n = 0; n < IM_ARRAYSIZE(expected); n++) {
+		const expected_event* e = &expected[n];
+		if (n >= events.Size || events[n].what != e->what) {
+			mismatches++;
+			continue;
+		}
+		const t_event* event = &events[n];
+		if (e->what == 'm' && (event->uni.mouse.type != e->type || event->uni.mouse.action != e->action || event->uni.mouse.button != e->code))
+			mismatches++;
+		else if (e->what == 'm' && e->type == 1 && (event->uni.mouse.x != e->x || event->uni.mouse.y != e->y))
+			mismatches++;
+		else if (e->what == 'k' && (event->uni.keyboard.action != e->action || event->uni.keyboard.code != e->code))
+			mismatches++;
+	}
+	/* The text field was activated then deactivated by the events Dear ImGui captured */
+	const bool ok = mismatches == 0 && events.Size == IM_ARRAYSIZE(expected) && active_frames > 0 && !active;
+	printf("check/events  %d low level events, %d higher level events (expected %d), %d mismatches, text field active %d frames %s\n",
+		IM_ARRAYSIZE(script), events.Size, IM_ARRAYSIZE(expected), mismatches, active_frames, ok ? "OK" : "FAIL");
+	return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc == 2 && strcmp(argv[1], "check") == 0)
+		return run_check();
+
+	create_context();
+	char buf[16] = "";
+	char name[64];
+
+	/* Recognizer alone: press and release pairs turned into clicks, or kept apart when too slow */
+	const int iterations = 1000000;
+	const double gaps[] = { 0.1, 0.5 };
+	for (int g = 0; g < IM_ARRAYSIZE(gaps); g++) {
+		EventRecognizer recognizer;
+		t_event event;
+		int events = 0;
+		double t0 = bench_time();
+		for (int i = 0; i < iterations; i++) {
+			recognizer.add_mouse_button(i, 0, EVENT_PRESS, 0);
+			recognizer.add_mouse_button(i + gaps[g], 0, EVENT_RELEASE, 0);
+			recognizer.process(i + 1.0);
+			while (recognizer.next(event))
+				events++;
+		}
+		snprintf(name, sizeof(name), "recognizer/%s", events == iterations ? "clicks" : "press_release");
+		bench_report(name, iterations, bench_time() - t0);
+	}
+
+	/* Scripted frames: null backends, the window with the text field and the recognizer */
+	EventRecognizer recognizer;
+	const int frames = 400;
+	double t0 = bench_time();
+	for (int frame = 0; frame < frames; frame++) {
+		queue_events(&recognizer, frame);
+		ui_frame(buf, IM_ARRAYSIZE(buf));
+		recognizer.process(ImGui_ImplNullPlatform_GetTime());
+		t_event event;
+		while (recognizer.next(event)) {}
+	}
+	bench_report("frame/script", frames, bench_time() - t0);
+
+	destroy_context();
+	return 0;
+}
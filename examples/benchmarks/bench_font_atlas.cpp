@@ -0,0 +1,402 @@
+/*
+* Font atlas benchmark: build time and texture size of a font with a large glyph range
+* (U+0020..U+FFFF), built upfront on one thread and on worker threads (ImFontAtlas::BuildParallelFor),
+* and with ImFontAtlasFlags_DynamicGlyphs, plus the cost of rasterizing glyphs on first use,
+* the startup cost of restoring a build cache (ImFontAtlas::LoadBuildCacheFromMemory) instead,
+* and the build of signed distance fields (ImFontAtlasFlags_SDF).
+* The default font only has Latin-1, pass a larger TTF to get meaningful numbers, e.g.
+*   bench_font_atlas /usr/share/fonts/truetype/dejavu/DejaVuSans.ttf
+*
+* Usage:
+*   bench_font_atlas [font.ttf]          run timings
+*   bench_font_atlas check [font.ttf]    compare parallel, dynamic, cached and SDF builds against a single-threaded build
+*/
+#include "bench_common.h"
+#include <atomic>
+#include <thread>
+
+static const ImWchar all_ranges[] = { 0x0020, 0xFFFF, 0 };
+static const float font_size = 16.0f;
+
+static int thread_count()
+{
+	return ImMax((int)std::thread::hardware_concurrency(), 2);
+}
+
+/* ImFontAtlas::BuildParallelFor: the calling thread and thread_count() - 1 workers pull jobs from a shared counter */
+static void parallel_for(ImGuiJobFunc job_func, void* job_data, int job_count, void* user_data)
+{
+	std::atomic<int> next(0);
+	auto worker = [&]() {
+		for (int i = next++; i < job_count; i = next++)
+			job_func(job_data, i);
+	};
+	std::thread threads[64];
+	int count = ImMin(thread_count() - 1, IM_ARRAYSIZE(threads));
+	for (int i = 0; i < count; i++)
+		threads[i] = std::thread(worker);
+	worker();
+	for (int i = 0; i < count; i++)
+		threads[i].join();
+}
+
+/* io.ParallelForFn, counting its calls in user_data */
+static void parallel_for_counted(ImGuiJobFunc job_func, void* job_data, int job_count, void* user_data)
+{
+	(*(int*)user_data)++;
+	parallel_for(job_func, job_data, job_count, NULL);
+}
+
+enum t_build_mode { BUILD_STATIC, BUILD_PARALLEL, BUILD_DYNAMIC, BUILD_SDF };
+
+static ImFontAtlas* create_atlas(const char* font_path, t_build_mode mode)
+{
+	ImFontAtlas* atlas = IM_NEW(ImFontAtlas)();
+	if (mode == BUILD_PARALLEL)
+		atlas->BuildParallelFor = parallel_for;
+	if (mode == BUILD_DYNAMIC)
+		atlas->Flags |= ImFontAtlasFlags_DynamicGlyphs;
+	if (mode == BUILD_SDF)
+		atlas->Flags |= ImFontAtlasFlags_SDF;
+	ImFontConfig cfg;
+	cfg.GlyphRanges = all_ranges;
+	ImFont* font = font_path ? atlas->AddFontFromFileTTF(font_path, font_size, &cfg) : atlas->AddFontDefault(&cfg);
+	if (font == NULL) {
+		fprintf(stderr, "cannot load '%s'\n", font_path);
+		IM_DELETE(atlas);
+		return NULL;
+	}
+	return atlas;
+}
+
+/* Codepoints of the static build, in the order of the glyphs (tab excluded) */
+static void list_codepoints(const ImFont* font, ImVector<ImWchar>& out)
+{
+	out.resize(0);
+	for (int i = 0; i < font->Glyphs.Size; i++)
+		if (font->Glyphs[i].Codepoint != '\t')
+			out.push_back((ImWchar)font->Glyphs[i].Codepoint);
+}
+
+/*
+* Use the glyphs over as many frames as needed: the texture grows in NewFrame() when full,
+* glyphs that didn't fit used the fallback glyph and are still pending. Return the number of frames.
+*/
+static int use_glyphs(ImFont* font, const ImVector<ImWchar>& codepoints, double* seconds)
+{
+	int frames = 0;
+	for (;;) {
+		ImGui::NewFrame();
+		int pending = 0;
+		double t0 = bench_time();
+		for (int i = 0; i < codepoints.Size; i++)
+			if (font->IndexLookup[codepoints[i]] == IM_FONTGLYPH_INDEX_PENDING) {
+				font->LoadGlyph(codepoints[i]);
+				pending++;
+			}
+		*seconds += bench_time() - t0;
+		ImGui::EndFrame();
+		if (pending == 0)
+			return frames;
+		frames++;
+	}
+}
+
+static ImGuiContext* create_context(ImFontAtlas* atlas)
+{
+	ImGuiContext* ctx = ImGui::CreateContext(atlas);
+	ImGuiIO& io = ImGui::GetIO();
+	io.IniFilename = NULL;
+	io.DisplaySize = ImVec2(1280, 720);
+	io.DeltaTime = 1.0f / 60.0f;
+	unsigned char* pixels;
+	int tex_w, tex_h;
+	atlas->GetTexDataAsRGBA32(&pixels, &tex_w, &tex_h);
+	atlas->SetTexID((ImTextureID)(intptr_t)1);
+	return ctx;
+}
+
+static int compare_glyph(const ImFontAtlas* ref_atlas, const ImFontGlyph* ref, const ImFontAtlas* atlas, const ImFontGlyph* glyph)
+{
+	if (glyph == NULL || glyph->X0 != ref->X0 || glyph->Y0 != ref->Y0 || glyph->X1 != ref->X1 || glyph->Y1 != ref->Y1 ||
+		glyph->AdvanceX != ref->AdvanceX || glyph->Visible != ref->Visible)
+		return 1;
+	const int ref_x = (int)(ref->U0 * ref_atlas->TexWidth + 0.5f), ref_y = (int)(ref->V0 * ref_atlas->TexHeight + 0.5f);
+	const int x = (int)(glyph->U0 * atlas->TexWidth + 0.5f), y = (int)(glyph->V0 * atlas->TexHeight + 0.5f);
+	const int w = (int)((ref->U1 - ref->U0) * ref_atlas->TexWidth + 0.5f), h = (int)((ref->V1 - ref->V0) * ref_atlas->TexHeight + 0.5f);
+	if (w != (int)((glyph->U1 - glyph->U0) * atlas->TexWidth + 0.5f) || h != (int)((glyph->V1 - glyph->V0) * atlas->TexHeight + 0.5f))
+		return 1;
+	for (int j = 0; j < h; j++)
+		if (memcmp(ref_atlas->TexPixelsAlpha8 + (ref_y + j) * ref_atlas->TexWidth + ref_x, atlas->TexPixelsAlpha8 + (y + j) * atlas->TexWidth + x, w) != 0)
+			return 1;
+	return 0;
+}
+
+static bool same_build(const ImFontAtlas* ref_atlas, const ImFontAtlas* atlas)
+{
+	const ImFont* ref_font = ref_atlas->Fonts[0];
+	const ImFont* font = atlas->Fonts[0];
+	return atlas->TexWidth == ref_atlas->TexWidth && atlas->TexHeight == ref_atlas->TexHeight &&
+		memcmp(atlas->TexPixelsAlpha8, ref_atlas->TexPixelsAlpha8, (size_t)atlas->TexWidth * atlas->TexHeight) == 0 &&
+		font->Glyphs.Size == ref_font->Glyphs.Size && memcmp(font->Glyphs.Data, ref_font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes()) == 0;
+}
+
+/* Parallel build, through ImFontAtlas::BuildParallelFor or io.ParallelForFn by default: same texture and glyphs, byte for byte */
+static int check_parallel(const char* font_path)
+{
+	ImFontAtlas* ref_atlas = create_atlas(font_path, BUILD_STATIC);
+	ImFontAtlas* atlas = create_atlas(font_path, BUILD_PARALLEL);
+	ImFontAtlas* io_atlas = create_atlas(font_path, BUILD_STATIC);
+	if (ref_atlas == NULL || atlas == NULL || io_atlas == NULL)
+		return 1;
+	ref_atlas->Build();
+	atlas->Build();
+	ImGuiContext* ctx = ImGui::CreateContext(io_atlas);
+	int io_calls = 0;
+	ImGui::GetIO().ParallelForFn = parallel_for_counted;
+	ImGui::GetIO().ParallelForUserData = &io_calls;
+	io_atlas->Build();
+	ImGui::DestroyContext(ctx);
+	const bool same = same_build(ref_atlas, atlas) && same_build(ref_atlas, io_atlas) && io_calls == 1;
+	printf("check/parallel   %d threads, %dx%d texture, %d glyphs, io.ParallelForFn %s %s\n", thread_count(), atlas->TexWidth, atlas->TexHeight, atlas->Fonts[0]->Glyphs.Size,
+		io_calls ? "used" : "unused", same ? "OK" : "FAIL");
+	IM_DELETE(io_atlas);
+	IM_DELETE(atlas);
+	IM_DELETE(ref_atlas);
+	return same ? 0 : 1;
+}
+
+/* Dynamic glyphs: same metrics and pixels once rasterized, wherever they are in the texture */
+static int check_dynamic(const char* font_path)
+{
+	ImFontAtlas* ref_atlas = create_atlas(font_path, BUILD_STATIC);
+	ImFontAtlas* atlas = create_atlas(font_path, BUILD_DYNAMIC);
+	if (ref_atlas == NULL || atlas == NULL)
+		return 1;
+	ref_atlas->Build();
+	ImGuiContext* ctx = create_context(atlas);
+	const ImFont* ref_font = ref_atlas->Fonts[0];
+	ImFont* font = atlas->Fonts[0];
+	ImVector<ImWchar> codepoints;
+	list_codepoints(ref_font, codepoints);
+
+	/* Advances are known before rasterization */
+	int errors = 0;
+	for (int i = 0; i < codepoints.Size; i++)
+		if (font->GetCharAdvance(codepoints[i]) != ref_font->GetCharAdvance(codepoints[i]))
+			errors++;
+	/* Lookups don't rasterize: glyph pointers stay valid */
+	const int built_upfront = font->Glyphs.Size;
+	const ImFontGlyph* glyphs_data = font->Glyphs.Data;
+	for (int i = 0; i < codepoints.Size; i++)
+		if (font->FindGlyph(codepoints[i]) == NULL)
+			errors++;
+	if (font->Glyphs.Size != built_upfront || font->Glyphs.Data != glyphs_data)
+		errors++;
+	const int initial_height = atlas->TexHeight;
+	printf("check/advances   %d glyphs, %d built upfront, lookups %s %s\n", codepoints.Size, built_upfront,
+		font->Glyphs.Size != built_upfront ? "rasterized" : "read-only", errors ? "FAIL" : "OK");
+
+	double seconds = 0.0;
+	const int frames = use_glyphs(font, codepoints, &seconds);
+	int mismatches = 0;
+	for (int i = 0; i < codepoints.Size; i++)
+		mismatches += compare_glyph(ref_atlas, ref_font->FindGlyphNoFallback(codepoints[i]), atlas, font->FindGlyphNoFallback(codepoints[i]));
+	printf("check/glyphs     texture %dx%d -> %dx%d in %d frames (static %dx%d) %s (%d mismatches)\n", atlas->TexWidth, initial_height, atlas->TexWidth,
+		atlas->TexHeight, frames, ref_atlas->TexWidth, ref_atlas->TexHeight, mismatches ? "FAIL" : "OK", mismatches);
+	errors += mismatches;
+
+	ImGui::DestroyContext(ctx);
+	IM_DELETE(atlas);
+	IM_DELETE(ref_atlas);
+	return errors ? 1 : 0;
+}
+
+/* Build cache: the restored atlas is the built one, and a cache is rejected when an input changes */
+static int check_cache(const char* font_path)
+{
+	ImFontAtlas* ref_atlas = create_atlas(font_path, BUILD_STATIC);
+	ImFontAtlas* atlas = create_atlas(font_path, BUILD_STATIC);
+	if (ref_atlas == NULL || atlas == NULL)
+		return 1;
+	ref_atlas->Build();
+	ImVector<unsigned char> cache;
+	bool same = ref_atlas->SaveBuildCacheToMemory(&cache) && atlas->LoadBuildCacheFromMemory(cache.Data, cache.Size);
+	const ImFont* ref_font = ref_atlas->Fonts[0];
+	const ImFont* font = atlas->Fonts[0];
+	same = same && atlas->TexWidth == ref_atlas->TexWidth && atlas->TexHeight == ref_atlas->TexHeight &&
+		memcmp(atlas->TexPixelsAlpha8, ref_atlas->TexPixelsAlpha8, (size_t)atlas->TexWidth * atlas->TexHeight) == 0 &&
+		font->Glyphs.Size == ref_font->Glyphs.Size && memcmp(font->Glyphs.Data, ref_font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes()) == 0 &&
+		font->IndexLookup.Size == ref_font->IndexLookup.Size && memcmp(font->IndexLookup.Data, ref_font->IndexLookup.Data, (size_t)font->IndexLookup.size_in_bytes()) == 0 &&
+		font->IndexAdvanceX.Size == ref_font->IndexAdvanceX.Size && memcmp(font->IndexAdvanceX.Data, ref_font->IndexAdvanceX.Data, (size_t)font->IndexAdvanceX.size_in_bytes()) == 0 &&
+		font->FallbackChar == ref_font->FallbackChar && font->EllipsisChar == ref_font->EllipsisChar && font->DotChar == ref_font->DotChar &&
+		font->Ascent == ref_font->Ascent && font->Descent == ref_font->Descent && font->FontSize == ref_font->FontSize &&
+		atlas->TexUvWhitePixel.x == ref_atlas->TexUvWhitePixel.x && atlas->TexUvWhitePixel.y == ref_atlas->TexUvWhitePixel.y &&
+		memcmp(atlas->TexUvLines, ref_atlas->TexUvLines, sizeof(atlas->TexUvLines)) == 0 && atlas->IsBuilt();
+	for (int i = 0; same && i < atlas->CustomRects.Size; i++)
+		same = atlas->CustomRects[i].X == ref_atlas->CustomRects[i].X && atlas->CustomRects[i].Y == ref_atlas->CustomRects[i].Y;
+	printf("check/cache      %d KB, %dx%d texture, %d glyphs %s\n", cache.Size / 1024, atlas->TexWidth, atlas->TexHeight, font->Glyphs.Size, same ? "OK" : "FAIL");
+
+	/* Another size, another padding, truncated data */
+	ImFontAtlas* other_atlas = IM_NEW(ImFontAtlas)();
+	ImFontConfig cfg;
+	cfg.GlyphRanges = all_ranges;
+	cfg.SizePixels = font_size + 1.0f;
+	if (font_path)
+		other_atlas->AddFontFromFileTTF(font_path, cfg.SizePixels, &cfg);
+	else
+		other_atlas->AddFontDefault(&cfg);
+	bool rejected = !other_atlas->LoadBuildCacheFromMemory(cache.Data, cache.Size);
+	IM_DELETE(other_atlas);
+	other_atlas = create_atlas(font_path, BUILD_STATIC);
+	other_atlas->TexGlyphPadding = 2;
+	rejected = rejected && !other_atlas->LoadBuildCacheFromMemory(cache.Data, cache.Size);
+	IM_DELETE(other_atlas);
+	other_atlas = create_atlas(font_path, BUILD_STATIC);
+	rejected = rejected && !other_atlas->LoadBuildCacheFromMemory(cache.Data, cache.Size - 1) && !other_atlas->IsBuilt();
+	IM_DELETE(other_atlas);
+	printf("check/cache_key  size, padding and truncated data rejected %s\n", rejected ? "OK" : "FAIL");
+
+	IM_DELETE(atlas);
+	IM_DELETE(ref_atlas);
+	return (same && rejected) ? 0 : 1;
+}
+
+/*
+* SDF: same advances as the static build, same texture with worker threads, and the inside of every glyph
+* (distance field >= 0.5) is at least SdfSpread - 1 pixels away from the borders of its quad
+*/
+static int check_sdf(const char* font_path)
+{
+	ImFontAtlas* ref_atlas = create_atlas(font_path, BUILD_STATIC);
+	ImFontAtlas* atlas = create_atlas(font_path, BUILD_SDF);
+	ImFontAtlas* parallel_atlas = create_atlas(font_path, BUILD_SDF);
+	if (ref_atlas == NULL || atlas == NULL || parallel_atlas == NULL)
+		return 1;
+	parallel_atlas->BuildParallelFor = parallel_for;
+	ref_atlas->Build();
+	atlas->Build();
+	parallel_atlas->Build();
+	const ImFont* ref_font = ref_atlas->Fonts[0];
+	const ImFont* font = atlas->Fonts[0];
+	int errors = 0;
+	for (int i = 0; i < ref_font->Glyphs.Size; i++)
+		if (font->GetCharAdvance((ImWchar)ref_font->Glyphs[i].Codepoint) != ref_font->Glyphs[i].AdvanceX)
+			errors++;
+	int outline_errors = 0;
+	const int spread = atlas->SdfSpread;
+	for (int i = 0; i < font->Glyphs.Size; i++) {
+		const ImFontGlyph& g = font->Glyphs[i];
+		if (!g.Visible)
+			continue;
+		const int x0 = (int)(g.U0 * atlas->TexWidth + 0.5f), y0 = (int)(g.V0 * atlas->TexHeight + 0.5f);
+		const int x1 = (int)(g.U1 * atlas->TexWidth + 0.5f), y1 = (int)(g.V1 * atlas->TexHeight + 0.5f);
+		int near_border = 0;
+		for (int y = y0; y < y1; y++)
+			for (int x = x0; x < x1; x++)
+				if (atlas->TexPixelsAlpha8[y * atlas->TexWidth + x] >= 128)
+					if (x < x0 + spread - 1 || x >= x1 - spread + 1 || y < y0 + spread - 1 || y >= y1 - spread + 1)
+						near_border++;
+		if (near_border > 0)
+			outline_errors++;
+	}
+	const bool parallel_same = atlas->TexWidth == parallel_atlas->TexWidth && atlas->TexHeight == parallel_atlas->TexHeight &&
+		memcmp(atlas->TexPixelsAlpha8, parallel_atlas->TexPixelsAlpha8, (size_t)atlas->TexWidth * atlas->TexHeight) == 0 &&
+		memcmp(font->Glyphs.Data, parallel_atlas->Fonts[0]->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes()) == 0;
+	printf("check/sdf        %dx%d texture (static %dx%d), %d glyphs, advances %s, outlines %s, parallel %s\n", atlas->TexWidth, atlas->TexHeight,
+		ref_atlas->TexWidth, ref_atlas->TexHeight, font->Glyphs.Size, errors ? "FAIL" : "OK", outline_errors ? "FAIL" : "OK", parallel_same ? "OK" : "FAIL");
+	IM_DELETE(parallel_atlas);
+	IM_DELETE(atlas);
+	IM_DELETE(ref_atlas);
+	return (errors == 0 && outline_errors == 0 && parallel_same) ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc >= 2 && strcmp(argv[1], "check") == 0) {
+		const char* font_path = argc >= 3 ? argv[2] : NULL;
+		int ret = check_parallel(font_path);
+		ret |= check_dynamic(font_path);
+		ret |= check_cache(font_path);
+		ret |= check_sdf(font_path);
+		return ret;
+	}
+	const char* font_path = argc >= 2 ? argv[1] : NULL;
+
+	const int iterations = 5;
+	char name[64];
+	for (int mode = BUILD_STATIC; mode <= BUILD_SDF; mode++) {
+		double best = 1e9;
+		ImFontAtlas* atlas = NULL;
+		for (int i = 0; i < iterations; i++) {
+			if (atlas)
+				IM_DELETE(atlas);
+			if ((atlas = create_atlas(font_path, (t_build_mode)mode)) == NULL)
+				return 1;
+			double t0 = bench_time();
+			atlas->Build();
+			best = ImMin(best, bench_time() - t0);
+		}
+		if (mode == BUILD_PARALLEL)
+			snprintf(name, sizeof(name), "build/parallel_%d_threads", thread_count());
+		else
+			snprintf(name, sizeof(name), "build/%s", mode == BUILD_DYNAMIC ? "dynamic" : mode == BUILD_SDF ? "sdf" : "static");
+		bench_report(name, 1, best);
+		printf("%-40s %dx%d texture, %d glyphs\n", name, atlas->TexWidth, atlas->TexHeight, atlas->Fonts[0]->Glyphs.Size);
+		IM_DELETE(atlas);
+	}
+
+	/* Startup with a build cache: what is left is loading the font file (for the key) and copying the texture */
+	ImVector<unsigned char> cache;
+	{
+		double best = 1e9;
+		ImFontAtlas* atlas = NULL;
+		for (int i = 0; i < iterations; i++) {
+			if (atlas)
+				IM_DELETE(atlas);
+			double t0 = bench_time();
+			if ((atlas = create_atlas(font_path, BUILD_STATIC)) == NULL)
+				return 1;
+			atlas->Build();
+			best = ImMin(best, bench_time() - t0);
+		}
+		bench_report("startup/build", 1, best);
+		atlas->SaveBuildCacheToMemory(&cache);
+		IM_DELETE(atlas);
+		best = 1e9;
+		for (int i = 0; i < iterations; i++) {
+			double t0 = bench_time();
+			atlas = create_atlas(font_path, BUILD_STATIC);
+			bool loaded = atlas->LoadBuildCacheFromMemory(cache.Data, cache.Size);
+			best = ImMin(best, bench_time() - t0);
+			IM_DELETE(atlas);
+			if (!loaded)
+				return 1;
+		}
+		bench_report("startup/cache", 1, best);
+		printf("%-40s %d KB cache\n", "startup/cache", cache.Size / 1024);
+	}
+
+	/* First use of up to 1000 non-ASCII glyphs, e.g. opening a window full of text */
+	ImFontAtlas* ref_atlas = create_atlas(font_path, BUILD_STATIC);
+	ImFontAtlas* atlas = create_atlas(font_path, BUILD_DYNAMIC);
+	if (ref_atlas == NULL || atlas == NULL)
+		return 1;
+	ref_atlas->Build();
+	ImGuiContext* ctx = create_context(atlas);
+	ImVector<ImWchar> all_codepoints, codepoints;
+	list_codepoints(ref_atlas->Fonts[0], all_codepoints);
+	for (int i = 0; i < all_codepoints.Size && codepoints.Size < 1000; i++)
+		if (all_codepoints[i] >= 0x80)
+			codepoints.push_back(all_codepoints[i]);
+	double seconds = 0.0;
+	int frames = use_glyphs(atlas->Fonts[0], codepoints, &seconds);
+	if (codepoints.Size > 0) {
+		bench_report("first_use/dynamic", codepoints.Size, seconds);
+		printf("%-40s %dx%d texture after %d frames\n", "first_use/dynamic", atlas->TexWidth, atlas->TexHeight, frames);
+	}
+	ImGui::DestroyContext(ctx);
+	IM_DELETE(atlas);
+	IM_DELETE(ref_atlas);
+	return 0;
+}
@@ -0,0 +1,137 @@
+/*
+* Widget ID hashing benchmark: ImHashStr()/ImHashData() throughput on typical labels,
+* and end-to-end frame time of an ID-heavy UI (buttons, checkboxes, tree nodes, PushID() loops).
+* Build it against each hash engine (see IMGUI_USE_HASH_XXX in imconfig.h) and compare.
+*
+* Usage:
+*   bench_ids              run timings
+*   bench_ids check        verify "###" semantics and sized vs zero-terminated hashing
+*/
+#include "bench_common.h"
+#include <stdlib.h>
+
+#if defined(IMGUI_USE_HASH_CRC32C)
+static const char* hash_engine_name = "crc32c";
+#elif defined(IMGUI_USE_HASH_WYHASH)
+static const char* hash_engine_name = "wyhash";
+#else
+static const char* hash_engine_name = "crc32";
+#endif
+
+static const char* labels[] = {
+	"OK", "Cancel", "Apply", "##hidden", "Enable shadows", "Draw wireframe",
+	"Texture filtering", "Anisotropic level##renderer", "Show debug overlay###overlay",
+	"Position", "Rotation", "Scale", "Material properties", "Vertex color",
+	"Very long label describing an option in a settings dialog", "X", "##x", "##y",
+};
+
+/* Reference for the "###" operator: hash what follows the last "###" (included) from the seed */
+static ImGuiID ref_hash_str(const char* s, ImU32 seed)
+{
+	const char* begin = s;
+	for (const char* p = s; *p; p++)
+		if (p[0] == '#' && p[1] == '#' && p[2] == '#')
+			begin = p;
+	return ImHashData(begin, strlen(begin), seed);
+}
+
+static int run_check()
+{
+	int errors = 0;
+	char buf[64];
+	const char alphabet[] = "ab#";
+	srand(1234);
+	for (int i = 0; i < 200000; i++) {
+		int len = rand() % 40;
+		for (int n = 0; n < len; n++)
+			buf[n] = alphabet[rand() % 3];
+		buf[len] = 0;
+		ImU32 seed = (i & 1) ? (ImU32)rand() : 0;
+		ImGuiID h = ImHashStr(buf, 0, seed);
+		if (len > 0 && h != ImHashStr(buf, len, seed))
+			errors++;
+		if (h != ref_hash_str(buf, seed))
+			errors++;
+	}
+	struct { const char* a; const char* b; bool equal; } pairs[] = {
+		{ "label###id", "###id", true },
+		{ "label###id", "other###id", true },
+		{ "a###b###c", "###c", true },
+		{ "label##a", "label##b", false },
+		{ "label##", "label", false },
+		{ "label#", "label", false },
+		{ "###", "x###", true },
+	};
+	for (int i = 0; i < IM_ARRAYSIZE(pairs); i++) {
+		bool equal = ImHashStr(pairs[i].a) == ImHashStr(pairs[i].b);
+		bool ok = equal == pairs[i].equal;
+		printf("check/%-8s \"%s\" %s \"%s\" %s\n", hash_engine_name, pairs[i].a, pairs[i].equal ? "==" : "!=", pairs[i].b, ok ? "OK" : "FAIL");
+		if (!ok)
+			errors++;
+	}
+	printf("check/%-8s random strings %s\n", hash_engine_name, errors ? "FAIL" : "OK");
+	return errors ? 1 : 0;
+}
+
+static void id_heavy_frame(int rows)
+{
+	static bool checks[64];
+	ImGui::NewFrame();
+	ImGui::SetNextWindowPos(ImVec2(0, 0));
+	ImGui::SetNextWindowSize(ImVec2(1280, 720));
+	ImGui::Begin("IDs", NULL, ImGuiWindowFlags_NoSavedSettings);
+	for (int i = 0; i < rows; i++) {
+		ImGui::PushID(i);
+		if (ImGui::TreeNodeEx("Node", ImGuiTreeNodeFlags_DefaultOpen)) {
+			ImGui::Button(labels[i % IM_ARRAYSIZE(labels)]);
+			ImGui::SameLine();
+			ImGui::Checkbox("Enable shadows", &checks[i % 64]);
+			ImGui::SameLine();
+			ImGui::SmallButton("Very long label describing an option in a settings dialog");
+			ImGui::TreePop();
+		}
+		ImGui::PopID();
+	}
+	ImGui::End();
+	ImGui::Render();
+}
+
+int main(int argc, char** argv)
+{
+	bench_create_context();
+
+	if (argc == 2 && strcmp(argv[1], "check") == 0) {
+		int ret = run_check();
+		ImGui::DestroyContext();
+		return ret;
+	}
+
+	/* Raw hashing, labels with mixed lengths and seeds like the ID stack would give */
+	const int iterations = 2000000;
+	ImGuiID acc = 0;
+	double t0 = bench_time();
+	for (int i = 0; i < iterations; i++)
+		acc += ImHashStr(labels[i % IM_ARRAYSIZE(labels)], 0, acc);
+	char name[64];
+	snprintf(name, sizeof(name), "hash_str/%s", hash_engine_name);
+	bench_report(name, iterations, bench_time() - t0);
+
+	t0 = bench_time();
+	for (int i = 0; i < iterations; i++)
+		acc += ImHashData(&i, sizeof(int), acc);
+	snprintf(name, sizeof(name), "hash_int/%s", hash_engine_name);
+	bench_report(name, iterations, bench_time() - t0);
+
+	/* End-to-end frames: 2000 rows x 4 IDs (most clipped, IDs are still computed) */
+	const int frames = 300;
+	for (int i = 0; i < 10; i++)
+		id_heavy_frame(2000);
+	t0 = bench_time();
+	for (int i = 0; i < frames; i++)
+		id_heavy_frame(2000);
+	snprintf(name, sizeof(name), "frame_2000_rows/%s", hash_engine_name);
+	bench_report(name, frames, bench_time() - t0);
+
+	ImGui::DestroyContext();
+	return acc == 0xFFFFFFFF ? 1 : 0;
+}
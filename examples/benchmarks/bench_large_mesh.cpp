@@ -0,0 +1,82 @@
+/*
+* Large mesh benchmark: 16-bit vs 32-bit indices (build with -DIMGUI_USE_32BIT_INDICES)
+* A window draws a ~1M vertices scene. With 16-bit indices the draw list gets split
+* every 64K vertices through ImDrawCmd::VtxOffset, with 32-bit indices it doesn't.
+*
+* Reports CPU time per frame (NewFrame() -> Render()), draw commands and buffer sizes.
+* Draw calls are counted the way imgui_impl_opengl2 issues them.
+*/
+#include "bench_common.h"
+#include <stdlib.h>
+
+#define NUM_RECTS (1000000 / 4)
+
+// Same merging rule as ImGui_ImplOpenGL2_RenderDrawData()
+static int count_draw_calls(const ImDrawData* draw_data)
+{
+	int draw_calls = 0;
+	for (int n = 0; n < draw_data->CmdListsCount; n++) {
+		const ImDrawList* cmd_list = draw_data->CmdLists[n];
+		for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++) {
+			const ImDrawCmd* pcmd = &cmd_list->CmdBuffer[cmd_i];
+			unsigned int elem_count = pcmd->ElemCount;
+			while (!pcmd->UserCallback && cmd_i + 1 < cmd_list->CmdBuffer.Size) {
+				const ImDrawCmd* next_cmd = &cmd_list->CmdBuffer[cmd_i + 1];
+				if (next_cmd->UserCallback || next_cmd->VtxOffset != pcmd->VtxOffset || next_cmd->IdxOffset != pcmd->IdxOffset + elem_count || next_cmd->GetTexID() != pcmd->GetTexID() || memcmp(&next_cmd->ClipRect, &pcmd->ClipRect, sizeof(ImVec4)) != 0)
+					break;
+				elem_count += next_cmd->ElemCount;
+				cmd_i++;
+			}
+			if (!pcmd->UserCallback)
+				draw_calls++;
+		}
+	}
+	return draw_calls;
+}
+
+int main(int argc, char** argv)
+{
+	bench_create_context(1920.0f, 1080.0f);
+
+	ImVector<ImVec2> pos, sizes;
+	ImVector<ImU32> cols;
+	pos.resize(NUM_RECTS);
+	sizes.resize(NUM_RECTS);
+	cols.resize(NUM_RECTS);
+	srand(1234);
+	for (int i = 0; i < NUM_RECTS; i++) {
+		pos[i] = ImVec2((float)(rand() % 1900), (float)(rand() % 1000));
+		sizes[i] = ImVec2(4.0f, 4.0f);
+		cols[i] = IM_COL32(rand() % 256, rand() % 256, rand() % 256, 255);
+	}
+
+	const int frames = 50;
+	double total = 0.0;
+	ImDrawData* draw_data = NULL;
+	for (int frame = 0; frame < frames + 1; frame++) {
+		double t0 = bench_time();
+		ImGui::NewFrame();
+		ImGui::SetNextWindowPos(ImVec2(0, 0));
+		ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+		ImGui::Begin("Scene", NULL, ImGuiWindowFlags_NoDecoration);
+		ImGui::GetWindowDrawList()->AddRectFilledBatch(pos.Data, sizes.Data, cols.Data, NUM_RECTS);
+		ImGui::End();
+		ImGui::Render();
+		draw_data = ImGui::GetDrawData();
+		if (frame > 0) // skip warm up frame
+			total += bench_time() - t0;
+	}
+
+	int cmds = 0;
+	for (int n = 0; n < draw_data->CmdListsCount; n++)
+		cmds += draw_data->CmdLists[n]->CmdBuffer.Size;
+	printf("large_mesh/idx%d %d vertices %d indices %d cmds %d draw calls, %.2f MB idx buffer\n",
+		(int)sizeof(ImDrawIdx) * 8, draw_data->TotalVtxCount, draw_data->TotalIdxCount, cmds, count_draw_calls(draw_data),
+		draw_data->TotalIdxCount * sizeof(ImDrawIdx) / (1024.0 * 1024.0));
+	char name[64];
+	snprintf(name, sizeof(name), "large_mesh/idx%d_frame", (int)sizeof(ImDrawIdx) * 8);
+	bench_report(name, frames, total);
+
+	ImGui::DestroyContext();
+	return 0;
+}
@@ -0,0 +1,140 @@
+/*
+* ImDrawList::AddPolyline() tessellation benchmark
+* Covers the anti-aliased thin, textured and thick line paths.
+*
+* Usage:
+*   bench_polyline                       run timings
+*   bench_polyline dump <file>           write the generated vertices of every case to <file>
+*   bench_polyline compare <a> <b> <tol> compare two dumps, fail if any coordinate differs by more than <tol>
+*/
+#include "bench_common.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define NUM_POINTS 10000
+
+struct t_polyline_case {
+	const char* name;
+	float thickness;
+	ImDrawListFlags flags;
+	bool closed;
+};
+
+static const t_polyline_case cases[] = {
+	{ "polyline/thin",           1.0f, ImDrawListFlags_AntiAliasedLines, false },
+	{ "polyline/thin_closed",    1.0f, ImDrawListFlags_AntiAliasedLines, true  },
+	{ "polyline/textured",       3.0f, ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex, false },
+	{ "polyline/thick",          4.5f, ImDrawListFlags_AntiAliasedLines, false },
+	{ "polyline/thick_closed",   4.5f, ImDrawListFlags_AntiAliasedLines, true  },
+	{ "polyline/no_aa",          2.0f, ImDrawListFlags_None, false },
+};
+
+static void make_points(ImVector<ImVec2>& points)
+{
+	// Noisy spiral: varying segment lengths and directions, plus a few duplicate points (zero-length segments)
+	points.resize(NUM_POINTS);
+	srand(1234);
+	for (int i = 0; i < NUM_POINTS; i++) {
+		float a = i * 0.05f;
+		float r = 50.0f + i * 0.03f;
+		points[i] = ImVec2(640.0f + cosf(a) * r + (rand() % 100) * 0.01f, 360.0f + sinf(a) * r + (rand() % 100) * 0.01f);
+		if (i > 0 && (i % 97) == 0)
+			points[i] = points[i - 1];
+	}
+}
+
+static void draw_case(ImDrawList* draw_list, const t_polyline_case& c, const ImVector<ImVec2>& points)
+{
+	draw_list->_ResetForNewFrame();
+	draw_list->Flags = c.flags | ImDrawListFlags_AllowVtxOffset;
+	draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+	draw_list->PushClipRectFullScreen();
+	draw_list->AddPolyline(points.Data, points.Size, IM_COL32(255, 200, 100, 255), c.closed ? ImDrawFlags_Closed : ImDrawFlags_None, c.thickness);
+}
+
+static int run_dump(ImDrawList* draw_list, const ImVector<ImVec2>& points, const char* filename)
+{
+	FILE* f = fopen(filename, "wb");
+	if (f == NULL) {
+		fprintf(stderr, "cannot open %s\n", filename);
+		return 1;
+	}
+	for (int n = 0; n < IM_ARRAYSIZE(cases); n++) {
+		draw_case(draw_list, cases[n], points);
+		int vtx_count = draw_list->VtxBuffer.Size;
+		fwrite(&vtx_count, sizeof(int), 1, f);
+		fwrite(draw_list->VtxBuffer.Data, sizeof(ImDrawVert), vtx_count, f);
+	}
+	fclose(f);
+	return 0;
+}
+
+static int run_compare(const char* filename_a, const char* filename_b, float tolerance)
+{
+	FILE* fa = fopen(filename_a, "rb");
+	FILE* fb = fopen(filename_b, "rb");
+	if (fa == NULL || fb == NULL) {
+		fprintf(stderr, "cannot open dumps\n");
+		return 1;
+	}
+	int errors = 0;
+	for (int n = 0; n < IM_ARRAYSIZE(cases); n++) {
+		int count_a = 0, count_b = 0;
+		if (fread(&count_a, sizeof(int), 1, fa) != 1 || fread(&count_b, sizeof(int), 1, fb) != 1 || count_a != count_b) {
+			fprintf(stderr, "%s: vertex count mismatch (%d vs %d)\n", cases[n].name, count_a, count_b);
+			return 1;
+		}
+		float max_diff = 0.0f;
+		int exact = 0;
+		for (int i = 0; i < count_a; i++) {
+			ImDrawVert va, vb;
+			if (fread(&va, sizeof(va), 1, fa) != 1 || fread(&vb, sizeof(vb), 1, fb) != 1)
+				return 1;
+			if (memcmp(&va, &vb, sizeof(va)) == 0)
+				exact++;
+			max_diff = ImMax(max_diff, ImMax(ImFabs(va.pos.x - vb.pos.x), ImFabs(va.pos.y - vb.pos.y)));
+			if (va.col != vb.col || va.uv.x != vb.uv.x || va.uv.y != vb.uv.y)
+				max_diff = FLT_MAX;
+		}
+		bool ok = max_diff <= tolerance;
+		printf("%-40s %8d vertices, %8d bit-identical, max diff %g %s\n", cases[n].name, count_a, exact, max_diff, ok ? "OK" : "FAIL");
+		if (!ok)
+			errors++;
+	}
+	fclose(fa);
+	fclose(fb);
+	return errors ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+	bench_create_context();
+	ImGui::NewFrame();
+	ImDrawList draw_list(ImGui::GetDrawListSharedData());
+
+	ImVector<ImVec2> points;
+	make_points(points);
+
+	int ret = 0;
+	if (argc == 3 && strcmp(argv[1], "dump") == 0) {
+		ret = run_dump(&draw_list, points, argv[2]);
+	}
+	else if (argc == 5 && strcmp(argv[1], "compare") == 0) {
+		ret = run_compare(argv[2], argv[3], (float)atof(argv[4]));
+	}
+	else {
+		const int iterations = 200;
+		for (int n = 0; n < IM_ARRAYSIZE(cases); n++) {
+			draw_case(&draw_list, cases[n], points); // warm up buffers
+			double t0 = bench_time();
+			for (int i = 0; i < iterations; i++)
+				draw_case(&draw_list, cases[n], points);
+			bench_report(cases[n].name, iterations, bench_time() - t0);
+		}
+	}
+
+	draw_list._ClearFreeMemory();
+	ImGui::EndFrame();
+	ImGui::DestroyContext();
+	return ret;
+}
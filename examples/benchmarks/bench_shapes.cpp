@@ -0,0 +1,169 @@
+/*
+* Filled shapes benchmark: AddConvexPolyFilled(), scatter-plot-like circles and grid-like rectangles,
+* drawn one by one with AddCircleFilled()/AddRectFilled() or all at once with AddCircleFilledBatch()/AddRectFilledBatch().
+*
+* Usage:
+*   bench_shapes           run timings
+*   bench_shapes check     verify that the batch functions match the one-by-one functions
+*/
+#include "bench_common.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define NUM_CIRCLES 100000
+
+static void begin_list(ImDrawList* draw_list, ImDrawListFlags flags)
+{
+	draw_list->_ResetForNewFrame();
+	draw_list->Flags = flags | ImDrawListFlags_AllowVtxOffset;
+	draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+	draw_list->PushClipRectFullScreen();
+}
+
+struct t_shapes {
+	ImVector<ImVec2> pos;
+	ImVector<ImVec2> sizes;
+	ImVector<float> radii;
+	ImVector<ImU32> cols;
+};
+
+enum ShapeMode {
+	CIRCLES_UNIFORM,	// same radius and color
+	CIRCLES_VARYING,	// per-circle radius and color
+	RECTS,
+	NUM_SHAPE_MODES
+};
+
+static const char* shape_mode_names[NUM_SHAPE_MODES] = { "circles", "circles_varying", "rects" };
+
+static void draw_shapes(ImDrawList* draw_list, ImDrawListFlags flags, const t_shapes& shapes, ShapeMode mode, float radius, bool batch)
+{
+	begin_list(draw_list, flags);
+	const ImU32 col = IM_COL32(100, 200, 255, 255);
+	const int count = shapes.pos.Size;
+	switch (mode) {
+	case CIRCLES_UNIFORM:
+		if (batch)
+			draw_list->AddCircleFilledBatch(shapes.pos.Data, count, radius, col);
+		else
+			for (int i = 0; i < count; i++)
+				draw_list->AddCircleFilled(shapes.pos[i], radius, col);
+		break;
+	case CIRCLES_VARYING:
+		if (batch)
+			draw_list->AddCircleFilledBatch(shapes.pos.Data, shapes.radii.Data, shapes.cols.Data, count);
+		else
+			for (int i = 0; i < count; i++)
+				draw_list->AddCircleFilled(shapes.pos[i], shapes.radii[i], shapes.cols[i]);
+		break;
+	default:
+		if (batch)
+			draw_list->AddRectFilledBatch(shapes.pos.Data, shapes.sizes.Data, shapes.cols.Data, count);
+		else
+			for (int i = 0; i < count; i++)
+				draw_list->AddRectFilled(shapes.pos[i], shapes.pos[i] + shapes.sizes[i], shapes.cols[i]);
+		break;
+	}
+}
+
+static void draw_polygon(ImDrawList* draw_list, ImDrawListFlags flags, const ImVector<ImVec2>& points)
+{
+	begin_list(draw_list, flags);
+	draw_list->AddConvexPolyFilled(points.Data, points.Size, IM_COL32(255, 128, 0, 255));
+}
+
+static int run_check(const t_shapes& shapes)
+{
+	ImDrawList ref(ImGui::GetDrawListSharedData());
+	ImDrawList out(ImGui::GetDrawListSharedData());
+	const ImDrawListFlags flags_list[] = { ImDrawListFlags_AntiAliasedFill, ImDrawListFlags_None };
+	const float radii[] = { 2.0f, 4.0f, 30.0f };
+	int errors = 0;
+	for (int m = 0; m < NUM_SHAPE_MODES; m++)
+	for (int f = 0; f < IM_ARRAYSIZE(flags_list); f++)
+	for (int r = 0; r < (m == CIRCLES_UNIFORM ? IM_ARRAYSIZE(radii) : 1); r++) {
+		draw_shapes(&ref, flags_list[f], shapes, (ShapeMode)m, radii[r], false);
+		draw_shapes(&out, flags_list[f], shapes, (ShapeMode)m, radii[r], true);
+		ref._PopUnusedDrawCmd();
+		out._PopUnusedDrawCmd();
+		bool ok = ref.VtxBuffer.Size == out.VtxBuffer.Size && ref.IdxBuffer.Size == out.IdxBuffer.Size && ref.CmdBuffer.Size == out.CmdBuffer.Size;
+		float max_diff = 0.0f;
+		if (ok) {
+			ok = memcmp(ref.IdxBuffer.Data, out.IdxBuffer.Data, ref.IdxBuffer.size_in_bytes()) == 0;
+			for (int i = 0; i < ref.CmdBuffer.Size; i++)
+				ok &= ref.CmdBuffer[i].VtxOffset == out.CmdBuffer[i].VtxOffset && ref.CmdBuffer[i].ElemCount == out.CmdBuffer[i].ElemCount;
+			for (int i = 0; i < ref.VtxBuffer.Size; i++) {
+				const ImDrawVert& a = ref.VtxBuffer[i];
+				const ImDrawVert& b = out.VtxBuffer[i];
+				max_diff = ImMax(max_diff, ImMax(ImFabs(a.pos.x - b.pos.x), ImFabs(a.pos.y - b.pos.y)));
+				ok &= a.col == b.col && a.uv.x == b.uv.x && a.uv.y == b.uv.y;
+			}
+			ok &= max_diff <= 0.01f;
+		}
+		printf("check/%-15s aa=%d radius=%-5g %8d vertices %4d cmds, max diff %g %s\n", shape_mode_names[m], flags_list[f] != 0, m == CIRCLES_UNIFORM ? radii[r] : 0.0f, out.VtxBuffer.Size, out.CmdBuffer.Size, max_diff, ok ? "OK" : "FAIL");
+		if (!ok)
+			errors++;
+	}
+	return errors ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+	bench_create_context();
+	ImGui::NewFrame();
+
+	// Random positions; radii/colors sorted in small groups like a scatter plot with a few series, some fully transparent
+	t_shapes shapes;
+	shapes.pos.resize(NUM_CIRCLES);
+	shapes.sizes.resize(NUM_CIRCLES);
+	shapes.radii.resize(NUM_CIRCLES);
+	shapes.cols.resize(NUM_CIRCLES);
+	srand(1234);
+	for (int i = 0; i < NUM_CIRCLES; i++) {
+		int series = i * 5 / NUM_CIRCLES;
+		shapes.pos[i] = ImVec2((rand() % 128000) * 0.01f, (rand() % 72000) * 0.01f);
+		shapes.sizes[i] = ImVec2(2.0f + (rand() % 8), 2.0f + (rand() % 8));
+		shapes.radii[i] = 1.5f + series * 2.0f + (rand() % 100) * 0.001f;
+		shapes.cols[i] = (i % 101) == 0 ? IM_COL32(0, 0, 0, 0) : IM_COL32(50 * series, 200, 255 - 50 * series, 255);
+	}
+
+	ImVector<ImVec2> polygon;
+	polygon.resize(1000);
+	for (int i = 0; i < polygon.Size; i++) {
+		float a = (IM_PI * 2.0f) * i / polygon.Size;
+		polygon[i] = ImVec2(640.0f + cosf(a) * 300.0f, 360.0f + sinf(a) * 300.0f);
+	}
+
+	int ret = 0;
+	if (argc == 2 && strcmp(argv[1], "check") == 0) {
+		ret = run_check(shapes);
+	}
+	else {
+		ImDrawList draw_list(ImGui::GetDrawListSharedData());
+		const int iterations = 10;
+		double t0;
+
+		draw_polygon(&draw_list, ImDrawListFlags_AntiAliasedFill, polygon);
+		t0 = bench_time();
+		for (int i = 0; i < iterations * 100; i++)
+			draw_polygon(&draw_list, ImDrawListFlags_AntiAliasedFill, polygon);
+		bench_report("convex_poly/aa_1000_points", iterations * 100, bench_time() - t0);
+
+		for (int m = 0; m < NUM_SHAPE_MODES; m++)
+		for (int aa = 0; aa < 2; aa++)
+		for (int batch = 0; batch < 2; batch++) {
+			ImDrawListFlags flags = aa == 0 ? ImDrawListFlags_AntiAliasedFill : ImDrawListFlags_None;
+			char name[64];
+			snprintf(name, sizeof(name), "%s/%s_100k%s", shape_mode_names[m], batch ? "batch" : "one_by_one", aa ? "_no_aa" : "");
+			draw_shapes(&draw_list, flags, shapes, (ShapeMode)m, 3.0f, batch != 0);
+			t0 = bench_time();
+			for (int i = 0; i < iterations; i++)
+				draw_shapes(&draw_list, flags, shapes, (ShapeMode)m, 3.0f, batch != 0);
+			bench_report(name, iterations, bench_time() - t0);
+		}
+	}
+
+	ImGui::EndFrame();
+	ImGui::DestroyContext();
+	return ret;
+}
@@ -0,0 +1,116 @@
+/*
+* ImGuiStorage benchmark: insertion of new keys, lookups of existing keys and lookups of missing keys,
+* at 1k, 10k and 100k keys. Build it with and without IMGUI_USE_HASHED_STORAGE (see imconfig.h) and compare.
+*
+* Usage:
+*   bench_storage          run timings
+*   bench_storage check    verify Get/Set/Ref/SetAllInt/BuildSortByKey against a reference
+*/
+#include "bench_common.h"
+#include <stdlib.h>
+
+#ifdef IMGUI_USE_HASHED_STORAGE
+static const char* storage_name = "hashed";
+#else
+static const char* storage_name = "sorted";
+#endif
+
+/* IDs like the ID stack would produce, and a few small integers like user code may use */
+static void make_keys(ImVector<ImGuiID>& keys, int count, unsigned int seed)
+{
+	keys.resize(count);
+	srand(seed);
+	for (int i = 0; i < count; i++)
+		keys[i] = (i % 16) == 0 ? (ImGuiID)i : ImHashData(&i, sizeof(i), seed);
+}
+
+static int run_check()
+{
+	const int count = 20000;
+	ImVector<ImGuiID> keys;
+	make_keys(keys, count, 1234);
+	ImGuiStorage storage;
+	int errors = 0;
+
+	for (int i = 0; i < count; i++)
+		storage.SetInt(keys[i], i);
+	for (int i = 0; i < count; i += 3)
+		*storage.GetIntRef(keys[i]) += 1;
+	for (int i = 0; i < count; i++)
+		if (storage.GetInt(keys[i], -1) != i + ((i % 3) == 0 ? 1 : 0))
+			errors++;
+	if (storage.Data.Size != count)
+		errors++;
+	for (int i = 0; i < 1000; i++) {
+		ImGuiID missing = 0xF0000000 + i;
+		if (storage.GetInt(missing, -7) != -7 || storage.GetVoidPtr(missing) != NULL)
+			errors++;
+	}
+	printf("check/%s get/set/ref %s\n", storage_name, errors ? "FAIL" : "OK");
+
+	/* Direct modification of Data then BuildSortByKey(), as documented */
+	int errors_sort = 0;
+	ImGuiStorage bulk;
+	for (int i = 0; i < count; i++)
+		bulk.Data.push_back(ImGuiStorage::ImGuiStoragePair(keys[i], (float)i));
+	bulk.BuildSortByKey();
+	for (int i = 0; i < count; i++)
+		if (bulk.GetFloat(keys[i], -1.0f) != (float)i)
+			errors_sort++;
+	bulk.SetAllInt(5);
+	for (int i = 0; i < count; i += 7)
+		if (bulk.GetInt(keys[i]) != 5)
+			errors_sort++;
+	bulk.Clear();
+	if (bulk.GetInt(keys[0], -1) != -1)
+		errors_sort++;
+	bulk.SetBool(keys[0], true);
+	if (!bulk.GetBool(keys[0]) || bulk.Data.Size != 1)
+		errors_sort++;
+	printf("check/%s bulk build/set all/clear %s\n", storage_name, errors_sort ? "FAIL" : "OK");
+
+	return (errors || errors_sort) ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+	if (argc == 2 && strcmp(argv[1], "check") == 0)
+		return run_check();
+
+	const int sizes[] = { 1000, 10000, 100000 };
+	ImGuiID acc = 0;
+	for (int s = 0; s < IM_ARRAYSIZE(sizes); s++) {
+		const int count = sizes[s];
+		ImVector<ImGuiID> keys;
+		make_keys(keys, count, 1234);
+		char name[64];
+
+		/* Insertions into an empty storage, in ID order (random from the storage point of view) */
+		const int insert_iterations = count >= 100000 ? 1 : 100000 / count;
+		ImGuiStorage storage;
+		double t0 = bench_time();
+		for (int it = 0; it < insert_iterations; it++) {
+			storage.Clear();
+			for (int i = 0; i < count; i++)
+				storage.SetInt(keys[i], i);
+		}
+		snprintf(name, sizeof(name), "insert_%dk/%s", count / 1000, storage_name);
+		bench_report(name, insert_iterations * count, bench_time() - t0);
+
+		/* Lookups of existing keys, like GetID() + tree node open state every frame */
+		const int lookups = 4000000;
+		t0 = bench_time();
+		for (int i = 0; i < lookups; i++)
+			acc += storage.GetInt(keys[(int)(((unsigned int)i * 7919u) % (unsigned int)count)]);
+		snprintf(name, sizeof(name), "lookup_hit_%dk/%s", count / 1000, storage_name);
+		bench_report(name, lookups, bench_time() - t0);
+
+		/* Lookups of missing keys, like Begin() querying a window that doesn't exist yet */
+		t0 = bench_time();
+		for (int i = 0; i < lookups; i++)
+			acc += storage.GetInt(0xF0000000 + i, 1);
+		snprintf(name, sizeof(name), "lookup_miss_%dk/%s", count / 1000, storage_name);
+		bench_report(name, lookups, bench_time() - t0);
+	}
+	return acc == 0xFFFFFFFF ? 1 : 0;
+}
@@ -0,0 +1,523 @@
+/*
+* Table data source benchmark (ImGui::TableDataSourceRows()): an event log of up to 10M rows whose cells are
+* computed from the row index, scrolled to the top, middle and bottom, unsorted and sorted,
+* and the cost of sorting: on one thread and on worker threads (io.ParallelForFn), in full and when rows are appended,
+* and in the background (io.BackgroundJobFn) while frames keep displaying the previous order.
+*
+* Usage:
+*   bench_table          run timings
+*   bench_table check    compare data source frames with frames submitting rows by hand (clipper + sorted order),
+*                        the cached sorts (parallel, appended rows, removed rows) with qsort(), and the frames and
+*                        orders of background sorts
+*/
+#include "bench_common.h"
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+enum { MODE_MANUAL, MODE_SOURCE, MODE_SORT_ROWS };
+
+static int thread_count()
+{
+	return ImMax((int)std::thread::hardware_concurrency(), 2);
+}
+
+/* io.ParallelForFn: the calling thread and thread_count() - 1 workers pull jobs from a shared counter */
+static void parallel_for(ImGuiJobFunc job_func, void* job_data, int job_count, void* user_data)
+{
+	std::atomic<int> next(0);
+	auto worker = [&]() {
+		for (int i = next++; i < job_count; i = next++)
+			job_func(job_data, i);
+	};
+	std::thread threads[64];
+	int count = ImMin(thread_count() - 1, IM_ARRAYSIZE(threads));
+	for (int i = 0; i < count; i++)
+		threads[i] = std::thread(worker);
+	worker();
+	for (int i = 0; i < count; i++)
+		threads[i].join();
+}
+
+/* io.BackgroundJobFn: one thread per job. While 'background_gate' is closed, jobs wait before running (frames during a sort) */
+static std::atomic<bool> background_gate(true);
+
+static void background_job(ImGuiJobFunc job_func, void* job_data, void*)
+{
+	std::thread([=]() {
+		while (!background_gate.load())
+			std::this_thread::yield();
+		job_func(job_data, 0);
+	}).detach();
+}
+
+/* Event fields, computed from the row index */
+static ImU32 event_hash(int n) { ImU32 h = (ImU32)n * 2654435761u; return h ^ (h >> 15); }
+static int event_time(int n) { return n * 40 + (int)(event_hash(n) % 40); }
+static int event_severity(int n) { ImU32 h = event_hash(n) % 100; return h < 70 ? 0 : h < 90 ? 1 : h < 98 ? 2 : 3; }
+static int event_source(int n) { return (int)((event_hash(n) >> 8) % 6); }
+
+static const char* get_cell(void*, int row, int column, char* buf, int buf_size)
+{
+	static const char* severities[] = { "Info", "Warning", "Error", "Fatal" };
+	static const char* sources[] = { "Network", "Renderer", "Audio", "Input", "Scripting", "Physics" };
+	switch (column) {
+	case 0: snprintf(buf, (size_t)buf_size, "%d.%03d", event_time(row) / 1000, event_time(row) % 1000); return buf;
+	case 1: return severities[event_severity(row)];
+	case 2: return sources[event_source(row)];
+	default: snprintf(buf, (size_t)buf_size, "Event %d, code 0x%04X", row, event_hash(row) & 0xFFFF); return buf;
+	}
+}
+
+static int compare_rows(void*, int a, int b, int column)
+{
+	switch (column) {
+	case 0: return event_time(a) - event_time(b);
+	case 1: return event_severity(a) - event_severity(b);
+	case 2: return event_source(a) - event_source(b);
+	default: return a - b;
+	}
+}
+
+struct sort_config {
+	int count;
+	int columns[2];
+	ImGuiSortDirection directions[2];
+};
+
+static const sort_config sort_none = { 0, { 0, 0 }, { ImGuiSortDirection_None, ImGuiSortDirection_None } };
+static const sort_config sort_time_desc = { 1, { 0, 0 }, { ImGuiSortDirection_Descending, ImGuiSortDirection_None } };
+static const sort_config sort_severity = { 1, { 1, 0 }, { ImGuiSortDirection_Ascending, ImGuiSortDirection_None } };
+static const sort_config sort_severity_source = { 2, { 1, 2 }, { ImGuiSortDirection_Descending, ImGuiSortDirection_Ascending } };
+
+/* Reference order for MODE_MANUAL: qsort() with the row index as last key, which gives the order of a stable sort */
+static const sort_config* qsort_config;
+
+static int qsort_compare(const void* lhs, const void* rhs)
+{
+	const int a = *(const int*)lhs, b = *(const int*)rhs;
+	for (int n = 0; n < qsort_config->count; n++) {
+		const int delta = compare_rows(NULL, a, b, qsort_config->columns[n]);
+		if (delta != 0)
+			return (qsort_config->directions[n] == ImGuiSortDirection_Descending) ? -delta : delta;
+	}
+	return a - b;
+}
+
+struct table_state {
+	int mode;
+	int rows_count;
+	bool fixed_widths;
+	const sort_config* sort;
+	bool sort_changed;
+	bool capture_order;
+	ImVector<int> order;    /* MODE_MANUAL: sorted by qsort(), MODE_SOURCE: copy of the table order when capture_order is set */
+	bool sorting;           /* MODE_SOURCE: TableIsDataSourceSorting() */
+	float scroll_y;
+	float scroll_max;
+	float message_width;
+};
+
+static void table_init(table_state* state, int mode, int rows_count, bool fixed_widths)
+{
+	state->mode = mode;
+	state->rows_count = rows_count;
+	state->fixed_widths = fixed_widths;
+	state->sort = &sort_none;
+	state->sort_changed = true;
+	state->capture_order = false;
+	state->sorting = false;
+	state->scroll_y = state->scroll_max = state->message_width = 0.0f;
+}
+
+static void qsort_rows(ImVector<int>& order, int rows_count, const sort_config* sort)
+{
+	order.resize(rows_count);
+	for (int i = 0; i < rows_count; i++)
+		order[i] = i;
+	qsort_config = sort;
+	qsort(order.Data, (size_t)rows_count, sizeof(int), qsort_compare);
+}
+
+static void table_set_sort(table_state* state, const sort_config* sort)
+{
+	state->sort = sort;
+	state->sort_changed = true;
+	if (state->mode == MODE_MANUAL) {
+		state->order.resize(0);
+		if (sort->count > 0)
+			qsort_rows(state->order, state->rows_count, sort);
+	}
+}
+
+static void table_frame(table_state* state)
+{
+	const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable |
+		ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_SortTristate | ImGuiTableFlags_SizingFixedFit;
+	const char* names[] = { "Time", "Severity", "Source", "Message" };
+	const float widths[] = { 100.0f, 80.0f, 80.0f, 0.0f };
+	char buf[64];
+
+	ImGui::NewFrame();
+	ImGui::SetNextWindowPos(ImVec2(0, 0));
+	ImGui::SetNextWindowSize(ImVec2(1280, 720));
+	ImGui::Begin("Events", NULL, ImGuiWindowFlags_NoSavedSettings);
+	if (ImGui::BeginTable("events", 4, flags)) {
+		for (int column = 0; column < 4; column++)
+			ImGui::TableSetupColumn(names[column], (column == 3) ? ImGuiTableColumnFlags_WidthStretch : 0, state->fixed_widths ? widths[column] : 0.0f);
+		ImGui::TableSetupScrollFreeze(0, 1);
+		if (state->sort_changed) {
+			ImGui::TableSetColumnSortDirection(0, ImGuiSortDirection_None, false);
+			for (int n = 0; n < state->sort->count; n++)
+				ImGui::TableSetColumnSortDirection(state->sort->columns[n], state->sort->directions[n], n > 0);
+			state->sort_changed = false;
+		}
+		ImGui::SetScrollY(state->scroll_y);
+		ImGui::TableHeadersRow();
+		if (state->mode == MODE_SOURCE) {
+			ImGui::TableDataSourceRows(state->rows_count, get_cell, compare_rows, NULL);
+			state->sorting = ImGui::TableIsDataSourceSorting();
+			if (state->capture_order)
+				state->order = ImGui::GetCurrentTable()->DataSourceOrder;
+		} else {
+			const int* order = (state->mode == MODE_SORT_ROWS) ? ImGui::TableSortRows(state->rows_count, compare_rows, NULL) : (state->order.Size ? state->order.Data : NULL);
+			ImGuiListClipper clipper;
+			clipper.Begin(state->rows_count);
+			while (clipper.Step())
+				for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+					const int row = order ? order[i] : i;
+					ImGui::TableNextRow();
+					for (int column = 0; column < 4; column++)
+						if (ImGui::TableSetColumnIndex(column))
+							ImGui::TextUnformatted(get_cell(NULL, row, column, buf, IM_ARRAYSIZE(buf)));
+				}
+		}
+		state->scroll_max = ImGui::GetScrollMaxY();
+		state->message_width = ImGui::GetCurrentTable()->Columns[3].WidthAuto;
+		ImGui::EndTable();
+	}
+	ImGui::End();
+	ImGui::Render();
+}
+
+/* Flatten the draw data of the last frame */
+static void capture(ImVector<ImDrawVert>& vtx)
+{
+	vtx.resize(0);
+	ImDrawData* draw_data = ImGui::GetDrawData();
+	for (int n = 0; n < draw_data->CmdListsCount; n++) {
+		const ImDrawList* list = draw_data->CmdLists[n];
+		for (int i = 0; i < list->VtxBuffer.Size; i++)
+			vtx.push_back(list->VtxBuffer[i]);
+	}
+}
+
+/*
+* Sort 'rows_count' rows in a new context, after growing or shrinking the table through 'steps' (appended or removed rows).
+* Return the order of the last frame.
+*/
+static void sort_steps(ImVector<int>& order, const sort_config* sort, bool parallel, const int* steps, int steps_count)
+{
+	ImGuiContext* ctx = ImGui::GetCurrentContext();
+	ImGui::SetCurrentContext(NULL);
+	ImGuiContext* ctx_sort = bench_create_context();
+	if (parallel)
+		ImGui::GetIO().ParallelForFn = parallel_for;
+	table_state state;
+	table_init(&state, MODE_SOURCE, steps[0], true);
+	table_set_sort(&state, sort);
+	state.capture_order = true;
+	for (int n = 0; n < steps_count; n++) {
+		state.rows_count = steps[n];
+		table_frame(&state);
+	}
+	order.swap(state.order);
+	ImGui::DestroyContext(ctx_sort);
+	ImGui::SetCurrentContext(ctx);
+}
+
+/*
+* Every way of reaching the same rows count must give the order of a stable sort (qsort() with the row index as last key):
+* one thread or worker threads, sorted at once, with a few rows appended (binary insertion), many rows appended (merge),
+* and rows removed.
+*/
+static bool check_sort()
+{
+	const int full[] = { 200000 };
+	const int appended[] = { 100000, 100050, 100100, 150000, 200000 };
+	const int removed[] = { 250000, 200000 };
+	struct { const int* steps; int count; } variants[] = { { full, IM_ARRAYSIZE(full) }, { appended, IM_ARRAYSIZE(appended) }, { removed, IM_ARRAYSIZE(removed) } };
+	const sort_config* sorts[] = { &sort_time_desc, &sort_severity, &sort_severity_source };
+	int mismatches = 0, sorts_count = 0;
+	ImVector<int> reference, order;
+	for (int s = 0; s < IM_ARRAYSIZE(sorts); s++) {
+		qsort_rows(reference, 200000, sorts[s]);
+		for (int v = 0; v < IM_ARRAYSIZE(variants); v++)
+			for (int parallel = 0; parallel < 2; parallel++) {
+				sort_steps(order, sorts[s], parallel != 0, variants[v].steps, variants[v].count);
+				if (order.Size != reference.Size || memcmp(order.Data, reference.Data, (size_t)reference.size_in_bytes()) != 0)
+					mismatches++;
+				sorts_count++;
+			}
+	}
+	printf("check/sort   200000 rows, %d sorts (%d threads), %d mismatches %s\n", sorts_count, thread_count(), mismatches, mismatches ? "FAIL" : "OK");
+	return mismatches == 0;
+}
+
+static bool is_unsorted(const ImVector<int>& order, int rows_count)
+{
+	if (order.Size != rows_count)
+		return false;
+	for (int i = 0; i < rows_count; i++)
+		if (order[i] != i)
+			return false;
+	return true;
+}
+
+static bool is_sorted(const ImVector<int>& order, int rows_count, const sort_config* sort)
+{
+	ImVector<int> reference;
+	qsort_rows(reference, rows_count, sort);
+	return order.Size == reference.Size && memcmp(order.Data, reference.Data, (size_t)reference.size_in_bytes()) == 0;
+}
+
+/* Run frames until the background sort is done, return the frames count */
+static int frames_until_sorted(table_state* state)
+{
+	int frames = 0;
+	do {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		table_frame(state);
+		frames++;
+	} while (state->sorting && frames < 10000);
+	return frames;
+}
+
+/*
+* Sorting in the background (io.BackgroundJobFn, the job using io.ParallelForFn): while the job runs (held by background_gate),
+* frames display the previous order with rows appended meanwhile displayed last, and sort specs changing restart the sort.
+* Then the order must be the one of a stable sort of every row. DestroyContext() must cancel and wait for a running sort.
+*/
+static bool check_background()
+{
+	const int rows_count = 200000;
+	ImGuiContext* ctx = ImGui::GetCurrentContext();
+	ImGui::SetCurrentContext(NULL);
+	ImGuiContext* ctx_sort = bench_create_context();
+	ImGui::GetIO().BackgroundJobFn = background_job;
+	ImGui::GetIO().ParallelForFn = parallel_for;
+	table_state state;
+	table_init(&state, MODE_SOURCE, rows_count, true);
+	state.capture_order = true;
+	int failures = 0, frames = 0;
+
+	/* First sort: rows unsorted until done, rows appended during the sort are sorted once it is swapped in */
+	background_gate = false;
+	table_set_sort(&state, &sort_severity);
+	table_frame(&state);
+	failures += (!state.sorting || !is_unsorted(state.order, rows_count));
+	state.rows_count += 100;
+	table_frame(&state);
+	failures += (!state.sorting || !is_unsorted(state.order, rows_count + 100));
+	background_gate = true;
+	frames += frames_until_sorted(&state);
+	failures += (state.sorting || !is_sorted(state.order, state.rows_count, &sort_severity));
+
+	/* Sort specs changed twice: the previous order stays displayed, the first sort is discarded */
+	ImVector<int> previous = state.order;
+	background_gate = false;
+	table_set_sort(&state, &sort_severity_source);
+	table_frame(&state);
+	table_set_sort(&state, &sort_time_desc);
+	table_frame(&state);
+	failures += (!state.sorting || state.order.Size != previous.Size || memcmp(state.order.Data, previous.Data, (size_t)previous.size_in_bytes()) != 0);
+	background_gate = true;
+	frames += frames_until_sorted(&state);
+	failures += (state.sorting || !is_sorted(state.order, state.rows_count, &sort_time_desc));
+
+	/* Context destroyed while sorting: the job is cancelled once it runs */
+	background_gate = false;
+	table_set_sort(&state, &sort_severity);
+	table_frame(&state);
+	failures += !state.sorting;
+	std::thread open_gate([]() { std::this_thread::sleep_for(std::chrono::milliseconds(20)); background_gate = true; });
+	ImGui::DestroyContext(ctx_sort);
+	open_gate.join();
+	ImGui::SetCurrentContext(ctx);
+
+	printf("check/background %d rows, %d frames while sorting, %d failures %s\n", state.rows_count, frames, failures, failures ? "FAIL" : "OK");
+	return failures == 0;
+}
+
+/*
+* Run the same scripted frames in three contexts, one submitting rows by hand, one with TableDataSourceRows()
+* and one submitting rows by hand in the order of TableSortRows():
+* unsorted, then sorted on one column with many ties (stability), and on two columns, at several scroll positions.
+* Then check that auto-fit columns keep the width of the widest cell seen while scrolling.
+*/
+static int run_check()
+{
+	const int rows_count = 3000;
+	ImGuiContext* ctx_manual = ImGui::GetCurrentContext();
+	ImGui::SetCurrentContext(NULL);
+	ImGuiContext* ctx_source = bench_create_context();
+	ImGui::SetCurrentContext(NULL);
+	ImGuiContext* ctx_sort_rows = bench_create_context();
+	table_state manual, source, sort_rows;
+	table_init(&manual, MODE_MANUAL, rows_count, true);
+	table_init(&source, MODE_SOURCE, rows_count, true);
+	table_init(&sort_rows, MODE_SORT_ROWS, rows_count, true);
+
+	const sort_config* sorts[] = { &sort_none, &sort_time_desc, &sort_severity, &sort_severity_source };
+	const float positions[] = { 0.0f, 1234.5f, 0.5f, 1.0f }; /* Values <= 1.0f are fractions of the scroll range */
+	int mismatches = 0, frames = 0;
+	for (int s = 0; s < IM_ARRAYSIZE(sorts); s++)
+		for (int p = 0; p < IM_ARRAYSIZE(positions); p++) {
+			ImVector<ImDrawVert> vtx[3];
+			table_state* states[] = { &manual, &source, &sort_rows };
+			ImGuiContext* contexts[] = { ctx_manual, ctx_source, ctx_sort_rows };
+			for (int n = 0; n < 3; n++) {
+				ImGui::SetCurrentContext(contexts[n]);
+				if (p == 0)
+					table_set_sort(states[n], sorts[s]);
+				for (int i = 0; i < 3; i++) {
+					states[n]->scroll_y = (positions[p] <= 1.0f) ? positions[p] * states[n]->scroll_max : positions[p];
+					table_frame(states[n]);
+				}
+				capture(vtx[n]);
+			}
+			for (int n = 1; n < 3; n++)
+				if (vtx[n].Size != vtx[0].Size || memcmp(vtx[n].Data, vtx[0].Data, vtx[0].size_in_bytes()) != 0)
+					mismatches++;
+			frames++;
+		}
+	ImGui::DestroyContext(ctx_source);
+	ImGui::DestroyContext(ctx_sort_rows);
+	ImGui::SetCurrentContext(ctx_manual);
+	printf("check/order  %d rows, %d positions, %d mismatches %s\n", rows_count, frames, mismatches, mismatches ? "FAIL" : "OK");
+	const bool sort_ok = check_sort() && check_background();
+
+	/* Message texts get longer with the row index: the bottom rows are the widest (new context: the table above was left at the bottom) */
+	ImGui::DestroyContext(ctx_manual);
+	bench_create_context();
+	table_state widths;
+	table_init(&widths, MODE_SOURCE, rows_count, false);
+	table_set_sort(&widths, &sort_none);
+	const float fractions[] = { 0.0f, 1.0f, 0.0f };
+	float measured[3];
+	for (int f = 0; f < 3; f++) {
+		for (int i = 0; i < 3; i++) {
+			widths.scroll_y = fractions[f] * widths.scroll_max;
+			table_frame(&widths);
+		}
+		measured[f] = widths.message_width;
+	}
+	const bool widths_ok = measured[1] > measured[0] && measured[2] == measured[1];
+	printf("check/widths message column %.1f at top, %.1f at bottom, %.1f back at top %s\n", measured[0], measured[1], measured[2], widths_ok ? "OK" : "FAIL");
+	return (mismatches == 0 && sort_ok && widths_ok) ? 0 : 1;
+}
+
+static void run_frames(const char* prefix, const char* count_name, table_state* state, const char* suffix)
+{
+	const int iterations = 1000;
+	const float fractions[] = { 0.0f, 0.5f, 1.0f };
+	const char* fraction_names[] = { "top", "middle", "bottom" };
+	char name[64];
+	for (int f = 0; f < IM_ARRAYSIZE(fractions); f++) {
+		for (int i = 0; i < 3; i++) {
+			state->scroll_y = fractions[f] * state->scroll_max;
+			table_frame(state);
+		}
+		double t0 = bench_time();
+		for (int i = 0; i < iterations; i++)
+			table_frame(state);
+		snprintf(name, sizeof(name), "%s/%s/%s/%s", prefix, count_name, suffix, fraction_names[f]);
+		bench_report(name, iterations, bench_time() - t0);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	bench_create_context();
+
+	if (argc == 2 && strcmp(argv[1], "check") == 0) {
+		int ret = run_check();
+		ImGui::DestroyContext();
+		return ret;
+	}
+
+	const int counts[] = { 10000, 1000000, 10000000 };
+	const char* count_names[] = { "10k", "1M", "10M" };
+	char name[64];
+	for (int c = 0; c < IM_ARRAYSIZE(counts); c++) {
+		/* Reference: the same rows submitted by hand with a clipper, order sorted by the application */
+		table_state manual;
+		table_init(&manual, MODE_MANUAL, counts[c], false);
+		table_set_sort(&manual, &sort_none);
+		run_frames("manual", count_names[c], &manual, "unsorted");
+		if (counts[c] <= 1000000) {
+			double t0 = bench_time();
+			table_set_sort(&manual, &sort_severity_source);
+			snprintf(name, sizeof(name), "manual/%s/qsort", count_names[c]);
+			bench_report(name, 1, bench_time() - t0);
+		}
+
+		table_state source;
+		table_init(&source, MODE_SOURCE, counts[c], false);
+		table_set_sort(&source, &sort_none);
+		run_frames("source", count_names[c], &source, "unsorted");
+		table_set_sort(&source, &sort_severity_source);
+		double t0 = bench_time();
+		table_frame(&source);
+		snprintf(name, sizeof(name), "source/%s/sort_frame", count_names[c]);
+		bench_report(name, 1, bench_time() - t0);
+		run_frames("source", count_names[c], &source, "sorted");
+
+		/* Same sort on worker threads */
+		ImGui::GetIO().ParallelForFn = parallel_for;
+		table_set_sort(&source, &sort_severity_source);
+		t0 = bench_time();
+		table_frame(&source);
+		snprintf(name, sizeof(name), "source/%s/sort_frame_%d_threads", count_names[c], thread_count());
+		bench_report(name, 1, bench_time() - t0);
+		ImGui::GetIO().ParallelForFn = NULL;
+
+		/* Sort in the background (with worker threads): every frame displays the previous order until the sort is done */
+		ImGui::GetIO().BackgroundJobFn = background_job;
+		ImGui::GetIO().ParallelForFn = parallel_for;
+		table_set_sort(&source, &sort_time_desc);
+		int sort_frames = 0;
+		double frame_max = 0.0;
+		t0 = bench_time();
+		do {
+			const double frame_t0 = bench_time();
+			table_frame(&source);
+			frame_max = ImMax(frame_max, bench_time() - frame_t0);
+			sort_frames++;
+		} while (source.sorting);
+		snprintf(name, sizeof(name), "source/%s/background_sort_frames", count_names[c]);
+		bench_report(name, sort_frames, bench_time() - t0);
+		printf("%-40s %8.3f ms longest frame\n", "", frame_max * 1e3);
+		ImGui::GetIO().BackgroundJobFn = NULL;
+		ImGui::GetIO().ParallelForFn = NULL;
+
+		/* Rows appended to the sorted table: a live log (100 rows per frame), then 10% more rows at once */
+		const int append_frames = 100;
+		t0 = bench_time();
+		for (int i = 0; i < append_frames; i++) {
+			source.rows_count += 100;
+			table_frame(&source);
+		}
+		snprintf(name, sizeof(name), "source/%s/append_100_rows_frame", count_names[c]);
+		bench_report(name, append_frames, bench_time() - t0);
+		source.rows_count += counts[c] / 10;
+		t0 = bench_time();
+		table_frame(&source);
+		snprintf(name, sizeof(name), "source/%s/append_10%%_frame", count_names[c]);
+		bench_report(name, 1, bench_time() - t0);
+	}
+
+	ImGui::DestroyContext();
+	return 0;
+}
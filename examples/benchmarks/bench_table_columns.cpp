@@ -0,0 +1,193 @@
+/*
+* Wide table benchmark: CPU time and draw calls of frames showing a table of 10, 32 and 64 columns
+* (64 is IMGUI_TABLE_MAX_COLUMNS), drawn with one draw channel per column merged by EndTable() (default),
+* with the internal ImGuiTableFlags_SingleDrawChannel, and with ImGuiTableFlags_NoClip for reference (no clipping at all,
+* and no frozen header row, which NoClip doesn't support). Cells either all fit their column, or one cell in eight strays
+* off its column.
+*
+* Usage:
+*   bench_table_columns          run timings
+*   bench_table_columns check    compare the visible geometry of SingleDrawChannel frames with default frames
+*/
+#include "bench_common.h"
+#include <stdlib.h>
+
+enum { MODE_CHANNELS, MODE_SINGLE, MODE_NOCLIP, MODE_COUNT };
+static const char* mode_names[] = { "channels", "single", "noclip" };
+
+/* Cells of one in eight: fitting their column, text longer than its column, or buttons with rounded frames longer than their column */
+enum { CELLS_FIT, CELLS_OVERFLOW_TEXT, CELLS_OVERFLOW_BUTTONS };
+
+struct table_config {
+	int columns;
+	int overflow;           /* CELLS_FIT, CELLS_OVERFLOW_TEXT, CELLS_OVERFLOW_BUTTONS */
+	bool freeze_column;     /* ScrollX with the first column frozen */
+	float scroll_x;
+	float scroll_y;
+};
+
+static void table_frame(const table_config* config, int mode)
+{
+	ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersV | ImGuiTableFlags_SizingFixedFit;
+	if (config->freeze_column)
+		flags |= ImGuiTableFlags_ScrollX;
+	if (mode == MODE_SINGLE)
+		flags |= ImGuiTableFlags_SingleDrawChannel;
+	if (mode == MODE_NOCLIP)
+		flags |= ImGuiTableFlags_NoClip;
+
+	ImGui::NewFrame();
+	ImGui::SetNextWindowPos(ImVec2(0, 0));
+	ImGui::SetNextWindowSize(ImGui::GetIO().DisplaySize);
+	ImGui::Begin("Table", NULL, ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoDecoration);
+	if (ImGui::BeginTable("table", config->columns, flags)) {
+		char name[16];
+		for (int column = 0; column < config->columns; column++) {
+			snprintf(name, sizeof(name), "C%d", column);
+			ImGui::TableSetupColumn(name, 0, 44.0f + (column % 3) * 5);   /* Column borders cross glyphs or fall between them */
+		}
+		ImGui::TableSetupScrollFreeze(config->freeze_column ? 1 : 0, mode == MODE_NOCLIP ? 0 : 1);
+		ImGui::SetScrollX(config->scroll_x);
+		ImGui::SetScrollY(config->scroll_y);
+		ImGui::TableHeadersRow();
+		ImGuiListClipper clipper;
+		clipper.Begin(1000);
+		while (clipper.Step())
+			for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+				ImGui::TableNextRow();
+				for (int column = 0; column < config->columns; column++) {
+					if (!ImGui::TableSetColumnIndex(column))
+						continue;
+					if (config->overflow == CELLS_OVERFLOW_TEXT && (row + column) % 8 == 0)
+						ImGui::TextUnformatted("Longer than its column");
+					else if (config->overflow == CELLS_OVERFLOW_BUTTONS && (row + column) % 8 == 0)
+						ImGui::Button("Longer than its column");
+					else
+						ImGui::Text("%d", (row * 7 + column) % 1000);
+				}
+			}
+		ImGui::EndTable();
+	}
+	ImGui::End();
+	ImGui::Render();
+}
+
+/* Draw calls a renderer would issue: non-empty commands */
+static int count_draw_calls()
+{
+	ImDrawData* draw_data = ImGui::GetDrawData();
+	int draw_calls = 0;
+	for (int n = 0; n < draw_data->CmdListsCount; n++) {
+		const ImDrawList* list = draw_data->CmdLists[n];
+		for (int cmd_n = 0; cmd_n < list->CmdBuffer.Size; cmd_n++) {
+			const ImDrawCmd* cmd = &list->CmdBuffer[cmd_n];
+			if (cmd->UserCallback == NULL && cmd->ElemCount > 0 && cmd->ClipRect.x < cmd->ClipRect.z && cmd->ClipRect.y < cmd->ClipRect.w)
+				draw_calls++;
+		}
+	}
+	return draw_calls;
+}
+
+/* Visible geometry: bounding box of each triangle clipped with its draw command, and its color, sorted */
+struct clipped_triangle {
+	float x1, y1, x2, y2;
+	ImU32 col;
+};
+
+static int compare_triangles(const void* lhs, const void* rhs)
+{
+	return memcmp(lhs, rhs, sizeof(clipped_triangle));
+}
+
+static void capture(ImVector<clipped_triangle>& triangles)
+{
+	triangles.resize(0);
+	ImDrawData* draw_data = ImGui::GetDrawData();
+	for (int n = 0; n < draw_data->CmdListsCount; n++) {
+		const ImDrawList* list = draw_data->CmdLists[n];
+		for (int cmd_n = 0; cmd_n < list->CmdBuffer.Size; cmd_n++) {
+			const ImDrawCmd* cmd = &list->CmdBuffer[cmd_n];
+			for (unsigned int i = 0; i + 2 < cmd->ElemCount; i += 3) {
+				const ImDrawIdx* idx = &list->IdxBuffer[cmd->IdxOffset + i];
+				const ImDrawVert* v[3] = { &list->VtxBuffer[cmd->VtxOffset + idx[0]], &list->VtxBuffer[cmd->VtxOffset + idx[1]], &list->VtxBuffer[cmd->VtxOffset + idx[2]] };
+				clipped_triangle t;
+				memset(&t, 0, sizeof(t));
+				t.x1 = ImMax(ImMin(v[0]->pos.x, ImMin(v[1]->pos.x, v[2]->pos.x)), cmd->ClipRect.x);
+				t.y1 = ImMax(ImMin(v[0]->pos.y, ImMin(v[1]->pos.y, v[2]->pos.y)), cmd->ClipRect.y);
+				t.x2 = ImMin(ImMax(v[0]->pos.x, ImMax(v[1]->pos.x, v[2]->pos.x)), cmd->ClipRect.z);
+				t.y2 = ImMin(ImMax(v[0]->pos.y, ImMax(v[1]->pos.y, v[2]->pos.y)), cmd->ClipRect.w);
+				t.col = v[0]->col;
+				if (t.x1 < t.x2 && t.y1 < t.y2)
+					triangles.push_back(t);
+			}
+		}
+	}
+	qsort(triangles.Data, (size_t)triangles.Size, sizeof(clipped_triangle), compare_triangles);
+}
+
+/*
+* The same frames drawn with one draw channel per column and with ImGuiTableFlags_SingleDrawChannel must show the same
+* triangles, clipped the same way: cells fitting or straying off their column, scrolled vertically (frozen header row),
+* and horizontally with a frozen first column partially covering the next one. Stray text is clipped on the CPU, so
+* those SingleDrawChannel frames must not have more draw calls. Stray buttons have rounded frames, which aren't clipped
+* on the CPU but with draw commands of their own.
+*/
+static int run_check()
+{
+	const int columns[] = { 10, 64 };
+	const float scrolls_x[] = { 0.0f, 130.0f };
+	int mismatches = 0, frames = 0, more_draw_calls = 0;
+	ImVector<clipped_triangle> triangles[2];
+	ImGui::GetStyle().FrameRounding = 4.0f;
+	for (int c = 0; c < IM_ARRAYSIZE(columns); c++)
+		for (int overflow = CELLS_FIT; overflow <= CELLS_OVERFLOW_BUTTONS; overflow++)
+			for (int s = 0; s < IM_ARRAYSIZE(scrolls_x); s++) {
+				table_config config = { columns[c], overflow, scrolls_x[s] > 0.0f, scrolls_x[s], 1234.5f };
+				int draw_calls[2];
+				for (int m = 0; m < 2; m++) {
+					for (int i = 0; i < 3; i++)
+						table_frame(&config, m == 0 ? MODE_CHANNELS : MODE_SINGLE);
+					capture(triangles[m]);
+					draw_calls[m] = count_draw_calls();
+				}
+				if (triangles[0].Size != triangles[1].Size || memcmp(triangles[0].Data, triangles[1].Data, (size_t)triangles[0].size_in_bytes()) != 0)
+					mismatches++;
+				if (overflow != CELLS_OVERFLOW_BUTTONS && draw_calls[1] > draw_calls[0])
+					more_draw_calls++;
+				frames++;
+			}
+	const bool ok = (mismatches == 0 && more_draw_calls == 0);
+	printf("check/clip  %d frames, %d mismatches, %d frames with more draw calls %s\n", frames, mismatches, more_draw_calls, ok ? "OK" : "FAIL");
+	return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+	bench_create_context(3840.0f, 1080.0f);
+
+	if (argc == 2 && strcmp(argv[1], "check") == 0) {
+		int ret = run_check();
+		ImGui::DestroyContext();
+		return ret;
+	}
+
+	const int iterations = 300;
+	const int columns[] = { 10, 32, 64 };
+	char name[64];
+	for (int c = 0; c < IM_ARRAYSIZE(columns); c++)
+		for (int overflow = CELLS_FIT; overflow <= CELLS_OVERFLOW_TEXT; overflow++)
+			for (int m = 0; m < MODE_COUNT; m++) {
+				table_config config = { columns[c], overflow, false, 0.0f, 1234.5f };
+				for (int i = 0; i < 3; i++)
+					table_frame(&config, m);
+				double t0 = bench_time();
+				for (int i = 0; i < iterations; i++)
+					table_frame(&config, m);
+				snprintf(name, sizeof(name), "frame/%d_columns/%s/%s", columns[c], overflow ? "overflow" : "fit", mode_names[m]);
+				bench_report(name, iterations, bench_time() - t0);
+				printf("%-40s %8d draw calls\n", "", count_draw_calls());
+			}
+
+	ImGui::DestroyContext();
+	return 0;
+}
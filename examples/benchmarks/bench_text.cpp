@@ -0,0 +1,162 @@
+/*
+* Text measurement benchmark: ImFont::CalcTextSizeA() on log-like ASCII lines, short labels,
+* multi-line text and UTF-8 text, plus a frame of log lines in a table.
+* Build it with and without SSE (bench_text_scalar) and compare.
+*
+* Usage:
+*   bench_text             run timings
+*   bench_text check       compare sizes and 'remaining' positions against a per-character reference
+*/
+#include "bench_common.h"
+#include <stdlib.h>
+
+#ifdef IMGUI_ENABLE_SSE
+static const char* text_path_name = "sse";
+#else
+static const char* text_path_name = "scalar";
+#endif
+
+static const char* log_line = "0.016667 : MOUSE Move 512.000000, 384.000000 [input] event queued for the visualizer, frame 12345 (ok)";
+static const char* labels[] = { "OK", "Cancel", "Enable shadows", "Texture filtering", "Position", "Material properties" };
+static const char* multi_line = "First line of a tooltip\nSecond line, a bit longer than the first one\r\n\tIndented third line\nEnd";
+static const char* utf8_text = "Temp\xC3\xA9rature: 21\xC2\xB0" "C, pr\xC3\xA9sent, na\xC3\xAFve caf\xC3\xA9 ... r\xC3\xA9sum\xC3\xA9 - \xE2\x82\xAC 12,50";
+
+/* Per-character reference, the same arithmetic as the scalar loop in CalcTextSizeA() */
+static ImVec2 ref_calc_text_size(ImFont* font, float size, float max_width, const char* text_begin, const char* text_end, const char** remaining)
+{
+	const float scale = size / font->FontSize;
+	ImVec2 text_size(0, 0);
+	float line_width = 0.0f;
+	const char* s = text_begin;
+	while (s < text_end) {
+		const char* prev_s = s;
+		unsigned int c = (unsigned int)*s;
+		if (c < 0x80)
+			s += 1;
+		else if ((s += ImTextCharFromUtf8(&c, s, text_end)), c == 0)
+			break;
+		if (c == '\n') {
+			text_size.x = ImMax(text_size.x, line_width);
+			text_size.y += size;
+			line_width = 0.0f;
+			continue;
+		}
+		if (c == '\r')
+			continue;
+		const float char_width = ((int)c < font->IndexAdvanceX.Size ? font->IndexAdvanceX.Data[c] : font->FallbackAdvanceX) * scale;
+		if (line_width + char_width >= max_width) {
+			s = prev_s;
+			break;
+		}
+		line_width += char_width;
+	}
+	if (text_size.x < line_width)
+		text_size.x = line_width;
+	if (line_width > 0 || text_size.y == 0.0f)
+		text_size.y += size;
+	if (remaining)
+		*remaining = s;
+	return text_size;
+}
+
+static int run_check(ImFont* font)
+{
+	int errors = 0;
+	char buf[300];
+	const char* pieces[] = { "a", "Hello ", "\n", "\r\n", "\t", "\xC3\xA9", "\xE2\x82\xAC", "0123456789", "~!@#", " " };
+	srand(1234);
+	for (int i = 0; i < 100000; i++) {
+		int len = 0;
+		int count = rand() % 40;
+		for (int n = 0; n < count; n++) {
+			const char* p = pieces[rand() % IM_ARRAYSIZE(pieces)];
+			int l = (int)strlen(p);
+			if (len + l >= (int)sizeof(buf)) break;
+			memcpy(buf + len, p, l);
+			len += l;
+		}
+		buf[len] = 0;
+		float size = (i & 1) ? font->FontSize : font->FontSize * 1.5f;
+		float max_width = (i % 3) == 0 ? (float)(rand() % 200) : FLT_MAX;
+		const char* rem = NULL;
+		const char* ref_rem = NULL;
+		ImVec2 sz = font->CalcTextSizeA(size, max_width, 0.0f, buf, buf + len, &rem);
+		ImVec2 ref = ref_calc_text_size(font, size, max_width, buf, buf + len, &ref_rem);
+		if (sz.x != ref.x || sz.y != ref.y || rem != ref_rem)
+			errors++;
+	}
+	printf("check/%-8s random strings %s (%d mismatches)\n", text_path_name, errors ? "FAIL" : "OK", errors);
+	return errors ? 1 : 0;
+}
+
+static void log_table_frame(int rows)
+{
+	ImGui::NewFrame();
+	ImGui::SetNextWindowPos(ImVec2(0, 0));
+	ImGui::SetNextWindowSize(ImVec2(1280, 720));
+	ImGui::Begin("Log", NULL, ImGuiWindowFlags_NoSavedSettings);
+	if (ImGui::BeginTable("log", 2, ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY)) {
+		for (int i = 0; i < rows; i++) {
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::Text("%d", i);
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(log_line);
+		}
+		ImGui::EndTable();
+	}
+	ImGui::End();
+	ImGui::Render();
+}
+
+int main(int argc, char** argv)
+{
+	bench_create_context();
+	ImFont* font = ImGui::GetIO().Fonts->Fonts[0];
+
+	if (argc == 2 && strcmp(argv[1], "check") == 0) {
+		int ret = run_check(font);
+		ImGui::DestroyContext();
+		return ret;
+	}
+
+	char name[64];
+	float acc = 0.0f;
+	const int iterations = 1000000;
+	struct { const char* name; const char* text; } cases[] = {
+		{ "log_line", log_line },
+		{ "multi_line", multi_line },
+		{ "utf8", utf8_text },
+	};
+	for (int c = 0; c < IM_ARRAYSIZE(cases); c++) {
+		const char* text = cases[c].text;
+		const char* text_end = text + strlen(text);
+		double t0 = bench_time();
+		for (int i = 0; i < iterations; i++)
+			acc += font->CalcTextSizeA(font->FontSize, FLT_MAX, 0.0f, text, text_end).x;
+		snprintf(name, sizeof(name), "%s/%s", cases[c].name, text_path_name);
+		bench_report(name, iterations, bench_time() - t0);
+	}
+
+	/* ImGui::CalcTextSize() needs a current font, hence the frame */
+	ImGui::NewFrame();
+	double t0 = bench_time();
+	for (int i = 0; i < iterations; i++)
+		acc += ImGui::CalcTextSize(labels[i % IM_ARRAYSIZE(labels)]).x;
+	snprintf(name, sizeof(name), "labels/%s", text_path_name);
+	bench_report(name, iterations, bench_time() - t0);
+	ImGui::EndFrame();
+
+	/* End-to-end: table of 2000 log lines without clipper, every line is measured */
+	const int frames = 300;
+	for (int i = 0; i < 10; i++)
+		log_table_frame(2000);
+	t0 = bench_time();
+	for (int i = 0; i < frames; i++)
+		log_table_frame(2000);
+	snprintf(name, sizeof(name), "frame_log_table/%s", text_path_name);
+	bench_report(name, frames, bench_time() - t0);
+
+	ImGui::DestroyContext();
+	return acc == -1.0f ? 1 : 0;
+}
@@ -0,0 +1,232 @@
+/*
+* Text layout cache benchmark (io.ConfigTextLayoutCache): frames of static labels (menus, buttons,
+* table headers), of wrapped paragraphs, of the demo window and of a long wrapped document
+* (line breaks cached by ImGuiTextWrapCache), alone or shown at two wrap widths, with the cache off and on.
+*
+* Usage:
+*   bench_text_cache          run timings
+*   bench_text_cache check    compare the draw data of both modes
+*/
+#include "bench_common.h"
+
+static const char* paragraph =
+	"Dear ImGui is a bloat-free graphical user interface library for C++. It outputs optimized vertex buffers "
+	"that you can render anytime in your 3D-pipeline enabled application. It is fast, portable, renderer agnostic "
+	"and self-contained (no external dependencies). Dear ImGui is designed to enable fast iterations and to empower "
+	"programmers to create content creation tools and visualization / debug tools.";
+
+static void labels_frame()
+{
+	static bool checks[16];
+	ImGui::NewFrame();
+	if (ImGui::BeginMainMenuBar()) {
+		const char* menus[] = { "File", "Editors", "Visualizer", "About" };
+		for (int i = 0; i < IM_ARRAYSIZE(menus); i++)
+			if (ImGui::BeginMenu(menus[i]))
+				ImGui::EndMenu();
+		ImGui::EndMainMenuBar();
+	}
+	ImGui::SetNextWindowPos(ImVec2(0, 20));
+	ImGui::SetNextWindowSize(ImVec2(1280, 700));
+	ImGui::Begin("Labels", NULL, ImGuiWindowFlags_NoSavedSettings);
+	if (ImGui::BeginTable("table", 6, ImGuiTableFlags_Borders)) {
+		const char* headers[] = { "Event time", "Source device", "Action kind", "Modifiers", "Position", "Comments" };
+		for (int i = 0; i < IM_ARRAYSIZE(headers); i++)
+			ImGui::TableSetupColumn(headers[i]);
+		ImGui::TableHeadersRow();
+		for (int row = 0; row < 40; row++)
+			for (int i = 0; i < IM_ARRAYSIZE(headers); i++) {
+				ImGui::TableNextColumn();
+				ImGui::TextUnformatted("Static cell content");
+			}
+		ImGui::EndTable();
+	}
+	for (int i = 0; i < 60; i++) {
+		ImGui::PushID(i);
+		ImGui::Button("Apply changes");
+		ImGui::SameLine();
+		ImGui::Checkbox("Enable shadows", &checks[i % 16]);
+		ImGui::SameLine();
+		ImGui::TextUnformatted("Texture filtering mode");
+		ImGui::PopID();
+	}
+	ImGui::End();
+	ImGui::Render();
+}
+
+static void wrapped_frame()
+{
+	ImGui::NewFrame();
+	ImGui::SetNextWindowPos(ImVec2(0, 0));
+	ImGui::SetNextWindowSize(ImVec2(640, 720));
+	ImGui::Begin("Wrapped", NULL, ImGuiWindowFlags_NoSavedSettings);
+	for (int i = 0; i < 10; i++)
+		ImGui::TextWrapped("%s", paragraph);
+	ImGui::End();
+	ImGui::Render();
+}
+
+static ImGuiTextBuffer document;
+static int document_paragraphs = 30;
+
+/* Wrapped text (30 paragraphs: 11 KB), scrolled to the middle */
+static void document_window(const char* name, float x, float width)
+{
+	if (document.empty())
+		for (int i = 0; i < document_paragraphs; i++)
+			document.appendf("%d. %s%s\n", i, paragraph, (i % 3) ? "" : "\n\tIndented line after a blank one.");
+	if (ImGuiWindow* window = ImGui::FindWindowByName(name))
+		ImGui::SetScrollY(window, window->ScrollMax.y * 0.5f);
+	ImGui::SetNextWindowPos(ImVec2(x, 0));
+	ImGui::SetNextWindowSize(ImVec2(width, 720));
+	ImGui::Begin(name, NULL, ImGuiWindowFlags_NoSavedSettings);
+	ImGui::PushTextWrapPos(0.0f);
+	ImGui::TextUnformatted(document.begin(), document.end());
+	ImGui::PopTextWrapPos();
+	ImGui::End();
+}
+
+static void document_frame()
+{
+	ImGui::NewFrame();
+	document_window("Document", 0.0f, 640.0f);
+	ImGui::Render();
+}
+
+/* The same document buffer at two wrap widths in one frame */
+static void document_views_frame()
+{
+	ImGui::NewFrame();
+	document_window("Document", 0.0f, 640.0f);
+	document_window("Narrow document", 660.0f, 400.0f);
+	ImGui::Render();
+}
+
+static void demo_frame()
+{
+	ImGui::NewFrame();
+	ImGui::ShowDemoWindow();
+	ImGui::Render();
+}
+
+/*
+* Flatten the draw data of the last frame.
+* clip_windows: only keep the vertices strictly within the inner clipping rectangle of their window (NULL-terminated list
+* of window names), and no indices. Without the cache, wrapped text is rendered from its first line, including the glyphs
+* scrolled out of the window.
+*/
+static void capture(ImVector<ImDrawVert>& vtx, ImVector<ImDrawIdx>& idx, const char** clip_windows = NULL)
+{
+	vtx.resize(0);
+	idx.resize(0);
+	ImDrawData* draw_data = ImGui::GetDrawData();
+	for (int n = 0; n < draw_data->CmdListsCount; n++) {
+		const ImDrawList* list = draw_data->CmdLists[n];
+		const ImRect* clip_rect = NULL;
+		for (int w = 0; clip_windows && clip_windows[w] && !clip_rect; w++)
+			if (ImGuiWindow* window = ImGui::FindWindowByName(clip_windows[w]))
+				if (window->DrawList == list)
+					clip_rect = &window->InnerClipRect;
+		if (clip_windows && !clip_rect)
+			continue;
+		for (int i = 0; i < list->VtxBuffer.Size; i++)
+			if (!clip_rect || (list->VtxBuffer[i].pos.y > clip_rect->Min.y && list->VtxBuffer[i].pos.y < clip_rect->Max.y))
+				vtx.push_back(list->VtxBuffer[i]);
+		for (int i = 0; i < list->IdxBuffer.Size && !clip_rect; i++)
+			idx.push_back(list->IdxBuffer[i]);
+	}
+}
+
+/*
+* With the cache, the last frame must lay out no wrapped text (one text after an edit), and render the same vertices.
+* "views" shows the same document buffer at two wrap widths: both layouts stay cached.
+*/
+static int run_check()
+{
+	void (*frames[])() = { labels_frame, wrapped_frame, demo_frame, document_frame, document_frame, document_views_frame };
+	const char* names[] = { "labels", "wrapped", "demo", "document", "edited", "views" };
+	const char* document_windows[] = { "Document", "Narrow document", NULL };
+	int errors = 0;
+	for (int f = 0; f < IM_ARRAYSIZE(frames); f++) {
+		ImVector<ImDrawVert> ref_vtx, vtx;
+		ImVector<ImDrawIdx> ref_idx, idx;
+		const bool edited = strcmp(names[f], "edited") == 0;
+		const bool document_only = frames[f] == document_frame || frames[f] == document_views_frame;
+		if (!edited) {
+			ImGui::GetIO().ConfigTextLayoutCache = false;
+			for (int i = 0; i < 3; i++)
+				frames[f]();
+			capture(ref_vtx, ref_idx, document_only ? document_windows : NULL);
+		}
+		ImGui::GetIO().ConfigTextLayoutCache = true;
+		for (int i = 0; i < 3; i++)	/* Quads are stored the second frame, replayed from the third */
+			frames[f]();
+		if (edited) {	/* Same buffer, new contents in the visible part: the text must be laid out again */
+			memcpy(document.Buf.Data + document.size() / 2, "A much longer word", 18);
+			frames[f]();
+		}
+		capture(vtx, idx, document_only ? document_windows : NULL);
+		const ImGuiTextLayoutCacheStats stats = GImGui->TextLayoutCache.StatsLastFrame;
+		const int wrap_layouts = GImGui->TextWrapCache.Layouts;	/* Last frame */
+		if (edited) {
+			ImGui::GetIO().ConfigTextLayoutCache = false;
+			for (int i = 0; i < 3; i++)
+				frames[f]();
+			capture(ref_vtx, ref_idx, document_only ? document_windows : NULL);
+		}
+		int mismatches = (vtx.Size != ref_vtx.Size || idx.Size != ref_idx.Size || wrap_layouts != (edited ? 1 : 0)) ? 1 : 0;
+
+		for (int i = 0; i < vtx.Size && !mismatches; i++)
+			if (ImFabs(vtx[i].pos.x - ref_vtx[i].pos.x) > 0.001f || ImFabs(vtx[i].pos.y - ref_vtx[i].pos.y) > 0.001f ||
+				vtx[i].uv.x != ref_vtx[i].uv.x || vtx[i].uv.y != ref_vtx[i].uv.y || vtx[i].col != ref_vtx[i].col)
+				mismatches++;
+		for (int i = 0; i < idx.Size && !mismatches; i++)
+			if (idx[i] != ref_idx[i])
+				mismatches++;
+		printf("check/%-8s %d vertices, %d quads hits, %d size hits, %d wrapped text layouts %s\n", names[f], vtx.Size, stats.QuadsHits, stats.SizeHits, wrap_layouts, mismatches ? "FAIL" : "OK");
+		errors += mismatches;
+	}
+	ImGui::GetIO().ConfigTextLayoutCache = false;
+	return errors ? 1 : 0;
+}
+
+int main(int argc, char** argv)
+{
+	bench_create_context();
+
+	if (argc == 2 && strcmp(argv[1], "check") == 0) {
+		int ret = run_check();
+		ImGui::DestroyContext();
+		return ret;
+	}
+
+	/*
+	* Without the cache, the 1 MB document would exceed 16-bit indices (its glyphs above the window are rendered too):
+	* it is only timed with the cache, the 30 paragraphs one (11 KB) gives the cost of wrapping without it.
+	*/
+	void (*frames[])() = { labels_frame, wrapped_frame, demo_frame, document_frame, document_frame };
+	const char* names[] = { "frame_labels", "frame_wrapped", "frame_demo", "frame_document_11k", "frame_document_1M" };
+	const int paragraphs[] = { 0, 0, 0, 30, 3000 };
+	const int iterations = 1000;
+	char name[64];
+	for (int f = 0; f < IM_ARRAYSIZE(frames); f++)
+		for (int cache = 0; cache < 2; cache++) {
+			if (paragraphs[f] > 30 && !cache)
+				continue;
+			if (paragraphs[f] != 0 && paragraphs[f] != document_paragraphs) {
+				document_paragraphs = paragraphs[f];
+				document.clear();
+			}
+			ImGui::GetIO().ConfigTextLayoutCache = cache != 0;
+			for (int i = 0; i < 10; i++)
+				frames[f]();
+			double t0 = bench_time();
+			for (int i = 0; i < iterations; i++)
+				frames[f]();
+			snprintf(name, sizeof(name), "%s/%s", names[f], cache ? "cache" : "no_cache");
+			bench_report(name, iterations, bench_time() - t0);
+		}
+
+	ImGui::DestroyContext();
+	return 0;
+}
@@ -0,0 +1,286 @@
+/*
+* Frame time benchmark over the demo window: ImGui::ShowDemoWindow() with every tree node and collapsing header
+* expanded, driven by a scripted mouse (moving over the window while wheel scrolling through it) at a fixed timestep.
+* Inputs go through the null platform backend and the draw data through the null renderer backend (imgui_impl_null.cpp).
+* Prints one JSON object, meant to be saved and compared across commits.
+*
+* Usage:
+*   bench_ui [frames] [per_frame]   run <frames> measured frames (default 600), per_frame adds one entry per frame
+*   bench_ui check                  run the script twice and compare the draw data sizes of every frame, and the number
+*                                   of tree nodes expanded with DEMO_TREE_NODES
+*
+* Tree nodes are opened from the item hooks of the test engine, hence the library build with IMGUI_ENABLE_TEST_ENGINE.
+* The hooks are only enabled while expanding, measured frames only pay for the (false) g.TestEngineHookItems tests.
+*/
+#include "bench_common.h"
+#include "imgui_impl_null.h"
+#include <math.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+/* Tree nodes and collapsing headers of imgui_demo.cpp reachable by expanding everything, update along with the demo */
+#define DEMO_TREE_NODES 150
+
+/* Test engine hooks, only ItemInfo() is used */
+static int expanded_nodes = 0;
+static ImGuiStorage expanded_ids;
+
+void ImGuiTestEngineHook_ItemAdd(ImGuiContext*, const ImRect&, ImGuiID) {}
+void ImGuiTestEngineHook_Log(ImGuiContext*, const char*, ...) {}
+const char* ImGuiTestEngine_FindItemDebugLabel(ImGuiContext*, ImGuiID) { return NULL; }
+void ImGuiTestEngineHook_ItemInfo(ImGuiContext* ctx, ImGuiID id, const char*, ImGuiItemStatusFlags flags)
+{
+	/* Open on next frame (menus are openable too but don't use the state storage, count each id once) */
+	if (!(flags & ImGuiItemStatusFlags_Openable) || (flags & ImGuiItemStatusFlags_Opened) || expanded_ids.GetInt(id) != 0)
+		return;
+	ctx->CurrentWindow->DC.StateStorage->SetInt(id, 1);
+	expanded_ids.SetInt(id, 1);
+	expanded_nodes++;
+}
+
+/* Allocation counters, through ImGui::SetAllocatorFunctions() */
+static int alloc_count = 0;
+static size_t alloc_bytes = 0;
+
+static void* bench_alloc(size_t size, void*)
+{
+	alloc_count++;
+	alloc_bytes += size;
+	return malloc(size);
+}
+
+static void bench_free(void* ptr, void*)
+{
+	free(ptr);
+}
+
+struct frame_stats {
+	double new_frame, show_demo, end_frame, render, total;  /* microseconds */
+	int vertices, indices, draw_lists, draw_cmds, draw_calls, allocs, alloc_bytes;
+};
+
+/* Mouse circling over the demo window, wheel scrolling down through the contents then back up */
+static void script_input(int frame, int frames)
+{
+	ImGui_ImplNullPlatform_AddMousePosEvent(925.0f + 200.0f * sinf(frame * 0.05f), 360.0f + 280.0f * cosf(frame * 0.031f));
+	ImGui_ImplNullPlatform_AddMouseWheelEvent(0.0f, (frame < frames / 2) ? -1.0f : 1.0f);
+}
+
+static void run_frame(frame_stats* stats, int frame, int frames)
+{
+	script_input(frame, frames);
+	const int allocs = alloc_count;
+	const size_t bytes = alloc_bytes;
+	ImGui_ImplNullRenderer_NewFrame();
+	ImGui_ImplNullPlatform_NewFrame();
+	double t0 = bench_time();
+	ImGui::NewFrame();
+	double t1 = bench_time();
+	ImGui::ShowDemoWindow();
+	double t2 = bench_time();
+	ImGui::EndFrame();
+	double t3 = bench_time();
+	ImGui::Render();
+	double t4 = bench_time();
+
+	ImDrawData* draw_data = ImGui::GetDrawData();
+	ImGui_ImplNullRenderer_RenderDrawData(draw_data);
+	stats->new_frame = (t1 - t0) * 1e6;
+	stats->show_demo = (t2 - t1) * 1e6;
+	stats->end_frame = (t3 - t2) * 1e6;
+	stats->render = (t4 - t3) * 1e6;
+	stats->total = (t4 - t0) * 1e6;
+	stats->vertices = draw_data->TotalVtxCount;
+	stats->indices = draw_data->TotalIdxCount;
+	stats->draw_lists = draw_data->CmdListsCount;
+	stats->draw_cmds = 0;
+	for (int n = 0; n < draw_data->CmdListsCount; n++)
+		stats->draw_cmds += draw_data->CmdLists[n]->CmdBuffer.Size;
+	stats->draw_calls = ImGui_ImplNullRenderer_GetStats()->DrawCalls;
+	stats->allocs = alloc_count - allocs;
+	stats->alloc_bytes = (int)(alloc_bytes - bytes);
+}
+
+/* Create a context and open every tree node of the demo, until a frame doesn't find new ones */
+static void setup()
+{
+	ImGuiContext& g = *ImGui::CreateContext();
+	ImGui::GetIO().IniFilename = NULL;
+	ImGui_ImplNullPlatform_Init(1280.0f, 800.0f);
+	ImGui_ImplNullRenderer_Init();
+	expanded_nodes = 0;
+	expanded_ids.Clear();
+	g.TestEngineHookItems = true;
+	for (int frame = 0, last_count = -1; frame < 500 && last_count != expanded_nodes; frame++) {
+		last_count = expanded_nodes;
+		ImGui_ImplNullRenderer_NewFrame();
+		ImGui_ImplNullPlatform_NewFrame();
+		ImGui::NewFrame();
+		ImGui::ShowDemoWindow();
+		ImGui::Render();
+		ImGui_ImplNullRenderer_RenderDrawData(ImGui::GetDrawData());
+	}
+	g.TestEngineHookItems = false;
+}
+
+static void shutdown()
+{
+	ImGui_ImplNullRenderer_Shutdown();
+	ImGui_ImplNullPlatform_Shutdown();
+	ImGui::DestroyContext();
+}
+
+static int cmp_double(const void* a, const void* b)
+{
+	const double da = *(const double*)a, db = *(const double*)b;
+	return (da < db) ? -1 : (da > db) ? 1 : 0;
+}
+
+/* {"mean": .., "min": .., "p50": .., "p95": .., "max": ..} of one frame_stats field */
+static void print_summary(const char* name, const frame_stats* stats, int frames, size_t offset, bool is_int, const char* suffix)
+{
+	ImVector<double> values;
+	values.resize(frames);
+	double sum = 0.0;
+	for (int i = 0; i < frames; i++) {
+		const char* p = (const char*)&stats[i] + offset;
+		values[i] = is_int ? (double)*(const int*)p : *(const double*)p;
+		sum += values[i];
+	}
+	qsort(values.Data, values.Size, sizeof(double), cmp_double);
+	printf("    \"%s\": { \"mean\": %.3f, \"min\": %.3f, \"p50\": %.3f, \"p95\": %.3f, \"max\": %.3f }%s\n", name,
+		sum / frames, values[0], values[frames / 2], values[(frames * 95) / 100], values[frames - 1], suffix);
+}
+
+/* Events queued all at once must reach the application as separate frames: a click, then typed text */
+static int check_input()
+{
+	ImGui::CreateContext();
+	ImGui::GetIO().IniFilename = NULL;
+	ImGui_ImplNullPlatform_Init(640.0f, 480.0f);
+	ImGui_ImplNullRenderer_Init();
+
+	char buf[16] = "";
+	int clicks = 0, frames = 0;
+	for (; frames < 20 && (frames < 3 || ImGui_ImplNullPlatform_GetPendingEventCount() > 0); frames++) {
+		if (frames == 1) {
+			ImGui_ImplNullPlatform_AddMousePosEvent(40.0f, 40.0f);
+			ImGui_ImplNullPlatform_AddMouseButtonEvent(0, true);
+			ImGui_ImplNullPlatform_AddMouseButtonEvent(0, false);
+			ImGui_ImplNullPlatform_AddMousePosEvent(40.0f, 70.0f);
+			ImGui_ImplNullPlatform_AddMouseButtonEvent(0, true);
+			ImGui_ImplNullPlatform_AddMouseButtonEvent(0, false);
+			for (const char* c = "abc"; *c; c++)
+				ImGui_ImplNullPlatform_AddInputCharacter(*c);
+			ImGui_ImplNullPlatform_AddKeyEvent(ImGuiKey_Backspace, true);
+			ImGui_ImplNullPlatform_AddKeyEvent(ImGuiKey_Backspace, false);
+		}
+		ImGui_ImplNullRenderer_NewFrame();
+		ImGui_ImplNullPlatform_NewFrame();
+		ImGui::NewFrame();
+		ImGui::SetNextWindowPos(ImVec2(0.0f, 0.0f));
+		ImGui::SetNextWindowSize(ImVec2(300.0f, 200.0f));
+		ImGui::Begin("Input", NULL, ImGuiWindowFlags_NoTitleBar);
+		ImGui::SetCursorScreenPos(ImVec2(20.0f, 30.0f));
+		if (ImGui::Button("Button", ImVec2(100.0f, 20.0f)))
+			clicks++;
+		ImGui::SetCursorScreenPos(ImVec2(20.0f, 60.0f));
+		ImGui::InputText("Text", buf, IM_ARRAYSIZE(buf));
+		ImGui::End();
+		ImGui::Render();
+		ImGui_ImplNullRenderer_RenderDrawData(ImGui::GetDrawData());
+	}
+	const double time = ImGui_ImplNullPlatform_GetTime();
+	const int uploads = ImGui_ImplNullRenderer_GetStats()->TextureUploads;
+	shutdown();
+
+	const bool ok = clicks == 1 && strcmp(buf, "ab") == 0 && uploads == 0 && fabs(time - frames / 60.0) < 1e-4;
+	printf("check/input  %d frames, %d clicks, text \"%s\" %s\n", frames, clicks, buf, ok ? "OK" : "FAIL");
+	return ok ? 0 : 1;
+}
+
+static int run_check()
+{
+	if (check_input() != 0)
+		return 1;
+	const int frames = 200;
+	ImVector<frame_stats> runs[2];
+	int nodes[2];
+	for (int run = 0; run < 2; run++) {
+		setup();
+		nodes[run] = expanded_nodes;
+		runs[run].resize(frames);
+		for (int frame = 0; frame < frames; frame++)
+			run_frame(&runs[run][frame], frame, frames);
+		shutdown();
+	}
+	int mismatches = 0;
+	for (int frame = 0; frame < frames; frame++)
+		if (runs[0][frame].vertices != runs[1][frame].vertices || runs[0][frame].indices != runs[1][frame].indices ||
+			runs[0][frame].draw_cmds != runs[1][frame].draw_cmds || runs[0][frame].draw_calls != runs[1][frame].draw_calls ||
+			runs[0][frame].vertices == 0)
+			mismatches++;
+	const bool ok = mismatches == 0 && nodes[0] == nodes[1] && nodes[0] == DEMO_TREE_NODES;
+	printf("check/demo  %d nodes expanded (expected %d), %d frames, %d mismatches %s\n", nodes[0], DEMO_TREE_NODES, frames, mismatches, ok ? "OK" : "FAIL");
+	return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+	ImGui::SetAllocatorFunctions(bench_alloc, bench_free);
+	if (argc == 2 && strcmp(argv[1], "check") == 0)
+		return run_check();
+
+	const int frames = (argc >= 2) ? atoi(argv[1]) : 600;
+	const bool per_frame = (argc >= 3 && strcmp(argv[2], "per_frame") == 0);
+	if (frames <= 0) {
+		fprintf(stderr, "usage: bench_ui [frames] [per_frame]\n");
+		return 1;
+	}
+
+	setup();
+	ImVector<frame_stats> stats;
+	stats.resize(frames);
+	frame_stats warmup;
+	for (int frame = 0; frame < 10; frame++)
+		run_frame(&warmup, 0, frames);
+	for (int frame = 0; frame < frames; frame++)
+		run_frame(&stats[frame], frame, frames);
+
+	printf("{\n");
+	printf("  \"benchmark\": \"bench_ui\",\n");
+	printf("  \"imgui_version\": \"%s\",\n", IMGUI_VERSION);
+	printf("  \"frames\": %d,\n", frames);
+	printf("  \"expanded_nodes\": %d,\n", expanded_nodes);
+	printf("  \"time_us\": {\n");
+	print_summary("new_frame", stats.Data, frames, offsetof(frame_stats, new_frame), false, ",");
+	print_summary("show_demo", stats.Data, frames, offsetof(frame_stats, show_demo), false, ",");
+	print_summary("end_frame", stats.Data, frames, offsetof(frame_stats, end_frame), false, ",");
+	print_summary("render", stats.Data, frames, offsetof(frame_stats, render), false, ",");
+	print_summary("total", stats.Data, frames, offsetof(frame_stats, total), false, "");
+	printf("  },\n");
+	printf("  \"draw_data\": {\n");
+	print_summary("vertices", stats.Data, frames, offsetof(frame_stats, vertices), true, ",");
+	print_summary("indices", stats.Data, frames, offsetof(frame_stats, indices), true, ",");
+	print_summary("draw_lists", stats.Data, frames, offsetof(frame_stats, draw_lists), true, ",");
+	print_summary("draw_cmds", stats.Data, frames, offsetof(frame_stats, draw_cmds), true, ",");
+	print_summary("draw_calls", stats.Data, frames, offsetof(frame_stats, draw_calls), true, "");
+	printf("  },\n");
+	printf("  \"allocations\": {\n");
+	print_summary("count", stats.Data, frames, offsetof(frame_stats, allocs), true, ",");
+	print_summary("bytes", stats.Data, frames, offsetof(frame_stats, alloc_bytes), true, "");
+	printf("  }%s\n", per_frame ? "," : "");
+	if (per_frame) {
+		printf("  \"per_frame\": [\n");
+		for (int i = 0; i < frames; i++) {
+			const frame_stats& s = stats[i];
+			printf("    { \"new_frame\": %.3f, \"show_demo\": %.3f, \"end_frame\": %.3f, \"render\": %.3f, \"vertices\": %d, \"indices\": %d, \"draw_cmds\": %d, \"draw_calls\": %d, \"allocs\": %d, \"alloc_bytes\": %d }%s\n",
+				s.new_frame, s.show_demo, s.end_frame, s.render, s.vertices, s.indices, s.draw_cmds, s.draw_calls, s.allocs, s.alloc_bytes, (i + 1 < frames) ? "," : "");
+		}
+		printf("  ]\n");
+	}
+	printf("}\n");
+
+	shutdown();
+	return 0;
+}
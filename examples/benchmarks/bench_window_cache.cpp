@@ -0,0 +1,195 @@
+/*
+* Window draw list cache benchmark (ImGuiWindowFlags_CacheDrawList): a grid of static panels,
+* idle or with one of them hovered, with and without the flag.
+*
+* Usage:
+*   bench_window_cache          run timings
+*   bench_window_cache check    compare cached frames with frames rebuilding every window
+*/
+#include "bench_common.h"
+
+#define PANELS_X 4
+#define PANELS_Y 4
+#define PANEL_W 320.0f
+#define PANEL_H 180.0f
+
+struct panels_state {
+	float values[PANELS_X * PANELS_Y];
+	int dirty_panel;        /* Panel whose value changed this frame, -1 if none */
+	int scroll_panel;
+	float scroll_y;
+	int renamed_panel;      /* Panel with a different title, same ID ("###") */
+	int built;              /* Number of panels which submitted their contents this frame */
+};
+
+static void panel_contents(int n, float value)
+{
+	static char buf[32] = "Editable";
+	static bool check = true;
+	ImGui::Text("Panel %d, value %.3f", n, value);
+	ImGui::Button("Apply");
+	ImGui::SameLine();
+	ImGui::Button("Revert");
+	ImGui::Checkbox("Enabled", &check);
+	float f = value;
+	ImGui::SliderFloat("Value", &f, 0.0f, 1.0f);
+	int i = n;
+	ImGui::DragInt("Index", &i);
+	ImGui::InputText("Name", buf, IM_ARRAYSIZE(buf));
+	ImGui::ProgressBar(value);
+	ImGui::Separator();
+	for (int line = 0; line < 4; line++)
+		ImGui::BulletText("Status line %d: nominal", line);
+	if (ImGui::BeginTable("table", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+		for (int row = 0; row < 4; row++) {
+			ImGui::TableNextRow();
+			for (int column = 0; column < 3; column++) {
+				ImGui::TableNextColumn();
+				ImGui::Text("%d,%d", row, column);
+			}
+		}
+		ImGui::EndTable();
+	}
+}
+
+static void panels_frame(panels_state* state, ImGuiWindowFlags flags)
+{
+	char name[32];
+	ImGui::NewFrame();
+	state->built = 0;
+	for (int n = 0; n < PANELS_X * PANELS_Y; n++) {
+		snprintf(name, sizeof(name), "Panel %d%s###Panel %d", n, (n == state->renamed_panel) ? " (renamed)" : "", n);
+		ImGui::SetNextWindowPos(ImVec2((n % PANELS_X) * PANEL_W, (n / PANELS_X) * PANEL_H));
+		ImGui::SetNextWindowSize(ImVec2(PANEL_W, PANEL_H));
+		if (n == state->dirty_panel)
+			ImGui::SetNextWindowDirty();
+		if (n == state->scroll_panel)
+			ImGui::SetNextWindowScroll(ImVec2(0.0f, state->scroll_y));
+		if (ImGui::Begin(name, NULL, flags | ImGuiWindowFlags_NoSavedSettings)) {
+			panel_contents(n, state->values[n]);
+			state->built++;
+		}
+		ImGui::End();
+	}
+	ImGui::Render();
+}
+
+static void panels_init(panels_state* state)
+{
+	for (int n = 0; n < PANELS_X * PANELS_Y; n++)
+		state->values[n] = n / (float)(PANELS_X * PANELS_Y);
+	state->dirty_panel = state->scroll_panel = state->renamed_panel = -1;
+	state->scroll_y = 0.0f;
+	state->built = 0;
+}
+
+/* Flatten the draw data of the last frame */
+static void capture(ImVector<ImDrawVert>& vtx, ImVector<ImDrawIdx>& idx)
+{
+	vtx.resize(0);
+	idx.resize(0);
+	ImDrawData* draw_data = ImGui::GetDrawData();
+	for (int n = 0; n < draw_data->CmdListsCount; n++) {
+		const ImDrawList* list = draw_data->CmdLists[n];
+		for (int i = 0; i < list->VtxBuffer.Size; i++)
+			vtx.push_back(list->VtxBuffer[i]);
+		for (int i = 0; i < list->IdxBuffer.Size; i++)
+			idx.push_back(list->IdxBuffer[i]);
+	}
+}
+
+/*
+* Run the same scripted frames in two contexts, one rebuilding every window and one with ImGuiWindowFlags_CacheDrawList:
+* idle, hovering a panel, changing a value (with SetNextWindowDirty()), scrolling a panel, changing the title of a panel
+* (without SetNextWindowDirty(): the title is part of the cache key). Draw data must be identical,
+* and the idle frames following each event must not submit any panel contents (the frame after an event saves its output).
+*/
+static int run_check()
+{
+	ImGuiContext* ctx_ref = ImGui::GetCurrentContext();
+	ImGui::SetCurrentContext(NULL);
+	ImGuiContext* ctx_cache = bench_create_context();
+	panels_state ref_state, state;
+	panels_init(&ref_state);
+	panels_init(&state);
+
+	const ImVec2 mouse_away(-FLT_MAX, -FLT_MAX);
+	const ImVec2 mouse_panel_5((5 % PANELS_X + 0.5f) * PANEL_W, (5 / PANELS_X + 0.5f) * PANEL_H);
+	int mismatches = 0, frames = 0, idle_built = 0, events_built = 0;
+	for (int frame = 0; frame < 35; frame++) {
+		const int phase = frame / 5, phase_frame = frame % 5;
+		const ImVec2 mouse_pos = (phase == 1) ? mouse_panel_5 : mouse_away;
+		const int dirty_panel = (phase == 3 && phase_frame == 0) ? 3 : -1;
+		if (dirty_panel != -1)
+			ref_state.values[dirty_panel] = state.values[dirty_panel] = 0.75f;
+		ref_state.dirty_panel = state.dirty_panel = dirty_panel;
+		if (phase == 4 && phase_frame == 0) {
+			ref_state.scroll_panel = state.scroll_panel = 7;
+			ref_state.scroll_y = state.scroll_y = 40.0f;
+		}
+		if (phase == 5 && phase_frame == 0)
+			ref_state.renamed_panel = state.renamed_panel = 9;
+
+		ImVector<ImDrawVert> ref_vtx, vtx;
+		ImVector<ImDrawIdx> ref_idx, idx;
+		ImGui::SetCurrentContext(ctx_ref);
+		ImGui::GetIO().MousePos = mouse_pos;
+		panels_frame(&ref_state, 0);
+		capture(ref_vtx, ref_idx);
+		ImGui::SetCurrentContext(ctx_cache);
+		ImGui::GetIO().MousePos = mouse_pos;
+		panels_frame(&state, ImGuiWindowFlags_CacheDrawList);
+		capture(vtx, idx);
+
+		if (vtx.Size != ref_vtx.Size || idx.Size != ref_idx.Size ||
+			memcmp(vtx.Data, ref_vtx.Data, vtx.size_in_bytes()) != 0 || memcmp(idx.Data, ref_idx.Data, idx.size_in_bytes()) != 0)
+			mismatches++;
+		if (phase > 0 && phase != 1 && phase_frame >= 3)
+			idle_built += state.built;
+		if (phase > 0 && phase_frame == 0)
+			events_built += state.built;
+		frames++;
+	}
+	ImGui::DestroyContext(ctx_cache);
+	ImGui::SetCurrentContext(ctx_ref);
+
+	/* Events: hovering panel 5 (rebuilt while hovered), leaving it, changing panel 3, scrolling panel 7, renaming panel 9: one panel rebuilt each */
+	const bool ok = mismatches == 0 && idle_built == 0 && events_built == 5;
+	printf("check/panels  %d frames, %d mismatches, %d panels built on events, %d on idle frames %s\n",
+		frames, mismatches, events_built, idle_built, ok ? "OK" : "FAIL");
+	return ok ? 0 : 1;
+}
+
+int main(int argc, char** argv)
+{
+	bench_create_context();
+
+	if (argc == 2 && strcmp(argv[1], "check") == 0) {
+		int ret = run_check();
+		ImGui::DestroyContext();
+		return ret;
+	}
+
+	const int iterations = 2000;
+	const char* flags_names[] = { "no_cache", "cache" };
+	const ImGuiWindowFlags flags[] = { 0, ImGuiWindowFlags_CacheDrawList };
+	const ImVec2 mouse_positions[] = { ImVec2(-FLT_MAX, -FLT_MAX), ImVec2(PANEL_W * 0.5f, PANEL_H * 0.5f) };
+	const char* mouse_names[] = { "idle", "hover_one" };
+	char name[64];
+	for (int m = 0; m < IM_ARRAYSIZE(mouse_positions); m++)
+		for (int f = 0; f < IM_ARRAYSIZE(flags); f++) {
+			panels_state state;
+			panels_init(&state);
+			ImGui::GetIO().MousePos = mouse_positions[m];
+			for (int i = 0; i < 10; i++)
+				panels_frame(&state, flags[f]);
+			double t0 = bench_time();
+			for (int i = 0; i < iterations; i++)
+				panels_frame(&state, flags[f]);
+			snprintf(name, sizeof(name), "frame_%d_panels/%s/%s", PANELS_X * PANELS_Y, mouse_names[m], flags_names[f]);
+			bench_report(name, iterations, bench_time() - t0);
+		}
+
+	ImGui::DestroyContext();
+	return 0;
+}
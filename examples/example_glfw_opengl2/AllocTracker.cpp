@@ -0,0 +1,8 @@
+#include "AllocTracker.h"
+#include "imgui.h"
+#include "imgui_internal.h"
+
+void install_alloc_tracker() {
+	static ImGuiAllocTracker alloc_tracker;
+	ImGui::InstallAllocTracker(&alloc_tracker);
+}
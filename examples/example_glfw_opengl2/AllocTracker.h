@@ -0,0 +1,10 @@
+#ifndef ALLOCTRACKER_H
+#define ALLOCTRACKER_H
+
+/*
+* Per-subsystem allocation statistics shown in Metrics->Memory (ImGuiAllocTracker).
+* Call once before ImGui::CreateContext().
+*/
+void install_alloc_tracker();
+
+#endif
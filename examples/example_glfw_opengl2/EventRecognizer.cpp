@@ -0,0 +1,102 @@
+#include "EventRecognizer.h"
+#include "imgui.h"
+
+bool EventRecognizer::add_key(double time, int code, int action, int mods) {
+	t_event event;
+	if(ImGui::GetIO().WantCaptureKeyboard)
+		return false;
+	event.what = 'k';
+	event.time = time;
+	event.uni.keyboard.action = action;
+	event.uni.keyboard.code = code;
+	event.uni.keyboard.mods = mods;
+	lo_level_events.insert(event);
+	return true;
+}
+
+bool EventRecognizer::add_mouse_button(double time, int button, int action, int mods) {
+	t_event event;
+	if(ImGui::GetIO().WantCaptureMouse)
+		return false;
+	event.what = 'm';
+	event.time = time;
+	event.uni.mouse.type   = 0;
+	event.uni.mouse.action = action;
+	event.uni.mouse.button = button;
+	event.uni.mouse.mods   = mods;
+	event.uni.mouse.x = event.uni.mouse.y = 0.0;
+	lo_level_events.insert(event);
+	return true;
+}
+
+bool EventRecognizer::add_mouse_move(double time, double x, double y) {
+	t_event event;
+	if(ImGui::GetIO().WantCaptureMouse)
+		return false;
+	event.what = 'm';
+	event.time = time;
+	event.uni.mouse.type = 1;
+	event.uni.mouse.action = event.uni.mouse.button = event.uni.mouse.mods = 0;
+	event.uni.mouse.x = x;
+	event.uni.mouse.y = y;
+	lo_level_events.insert(event);
+	return true;
+}
+
+void EventRecognizer::process(double time) {
+	t_event event1, event2;
+	double wait_time;
+
+	switch(lo_level_events.size()) {
+	case 0:	break;
+	case 1:
+		event1 = lo_level_events.elem(0);
+		wait_time = event1.what == 'm' ? CLICK_TIME : KEY_TIME;
+		if(time - event1.time > wait_time) {
+			lo_level_events.removeFirst();
+			hi_level_events.insert(event1);
+		}
+		break;
+	default:
+		event1 = lo_level_events.elem(0);
+		event2 = lo_level_events.elem(1);
+		switch(event1.what) {
+		case 'm':
+			if(event1.what==event2.what && 					// Mouse events
+			   event1.uni.mouse.type==0 && event2.uni.mouse.type==0 && 	// Mouse key events
+			   event1.uni.mouse.button==event2.uni.mouse.button && 		// Same Mouse buttons
+			   event1.uni.mouse.action==EVENT_PRESS && event2.uni.mouse.action==EVENT_RELEASE &&	// Press and Release in order
+			  (event2.time - event1.time <= CLICK_TIME) ) {			// Click detected
+				event2.uni.mouse.action = EVENT_CLICK;
+				hi_level_events.insert(event2);
+			} else {
+				hi_level_events.insert(event1);
+				hi_level_events.insert(event2);
+			}
+			break;
+		case 'k':
+			if(event1.what==event2.what && 					// Keyboard events
+			   event1.uni.keyboard.code==event2.uni.keyboard.code &&	// Same keys
+			   event1.uni.keyboard.action==EVENT_PRESS && event2.uni.keyboard.action==EVENT_RELEASE && // Press and Release in order
+			  (event2.time - event1.time <= KEY_TIME) ) {			// Keypress detected
+				event2.uni.keyboard.action = EVENT_CLICK;
+				hi_level_events.insert(event2);
+			} else {
+				hi_level_events.insert(event1);
+				hi_level_events.insert(event2);
+			}
+			break;
+		}
+		lo_level_events.removeFirst();
+		lo_level_events.removeFirst();
+		break;
+	}
+}
+
+bool EventRecognizer::next(t_event& event) {
+	if(hi_level_events.size() == 0)
+		return false;
+	event = hi_level_events.elem(0);
+	hi_level_events.removeFirst();
+	return true;
+}
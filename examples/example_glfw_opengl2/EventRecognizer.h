@@ -0,0 +1,79 @@
+#ifndef EVENTRECOGNIZER_H
+#define EVENTRECOGNIZER_H
+
+#include "CircularBuffer.h"
+
+/*
+* Event recognizer
+*
+* Low level mouse and keyboard events go in, higher level events come out: a press
+* followed by the release of the same button or key within CLICK_TIME or KEY_TIME
+* becomes a click or a keypress. Events are ignored while Dear ImGui captures the
+* device (io.WantCaptureMouse, io.WantCaptureKeyboard).
+*
+* Doesn't depend on GLFW: the caller provides the time, so it can be driven by the
+* GLFW callbacks (main.cpp) or by scripted events (examples/benchmarks/bench_events.cpp).
+*/
+
+#define CLICK_TIME 0.30
+#define KEY_TIME 0.40
+
+// t_mouse_input::action, t_keyboard_input::action (same values as GLFW_RELEASE, GLFW_PRESS)
+enum { EVENT_RELEASE = 0, EVENT_PRESS = 1, EVENT_CLICK = 2 };
+
+/*
+button: GLFW_MOUSE_BUTTON_LEFT, GLFW_MOUSE_BUTTON_RIGHT
+action: GLFW_PRESS, GLFW_RELEASE
+mods:   GLFW_MOD_SHIFT		0x0001
+mods:   GLFW_MOD_CONTROL	0x0002
+mods:   GLFW_MOD_ALT		0x0004
+mods:   GLFW_MOD_CONTROL	0x0008
+*/
+struct t_mouse_input {
+	int type;		// 0=mouse key, 1=mouse move
+	int action;		// 0=release, 1=press, 2=click (high level)
+	int button;		// 0=left,  1=right
+	int mods;
+	double x,y;		// mouse position
+};
+
+/*
+action: GLFW_PRESS, GLFW_REPEAT, GLFW_RELEASE
+mods:   GLFW_MOD_SHIFT		0x0001
+mods:   GLFW_MOD_CONTROL	0x0002
+mods:   GLFW_MOD_ALT		0x0004
+mods:   GLFW_MOD_CONTROL	0x0008
+*/
+struct t_keyboard_input {
+	int action;		// 0=release, 1=press, 2=click (high level)
+	int code;		// keyboard scancode with modifier keys
+	int mods;
+};
+
+struct t_event {
+	char what;	// k=keyboard, m=mouse
+	double time;	// timestamp
+	union {
+		struct t_mouse_input mouse;
+		struct t_keyboard_input keyboard;
+	} uni;
+};
+
+class EventRecognizer {
+public:
+	CircularBuffer<t_event> lo_level_events;
+	CircularBuffer<t_event> hi_level_events;
+
+	// Add an event to the low level event buffer, return false when Dear ImGui captures it
+	bool add_key(double time, int code, int action, int mods);
+	bool add_mouse_button(double time, int button, int action, int mods);
+	bool add_mouse_move(double time, double x, double y);
+
+	// Process the low level event buffer and generate higher level events
+	void process(double time);
+
+	// Remove the oldest higher level event, return false when there is none
+	bool next(t_event& event);
+};
+
+#endif
@@ -0,0 +1,65 @@
+#include "FontCache.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool load_font_cache(ImFontAtlas* atlas, const char* filename) {
+#ifndef _WIN32
+	int fd = open(filename, O_RDONLY);
+	if(fd < 0) return false;
+	struct stat st;
+	bool ret = false;
+	if(fstat(fd, &st) == 0 && st.st_size > 0) {
+		void* data = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(data != MAP_FAILED) {
+			ret = atlas->LoadBuildCacheFromMemory(data, (size_t)st.st_size);
+			munmap(data, (size_t)st.st_size);
+		}
+	}
+	close(fd);
+	return ret;
+#else
+	size_t size = 0;
+	void* data = ImFileLoadToMemory(filename, "rb", &size);
+	if(data == NULL) return false;
+	bool ret = atlas->LoadBuildCacheFromMemory(data, size);
+	IM_FREE(data);
+	return ret;
+#endif
+}
+
+bool save_font_cache(ImFontAtlas* atlas, const char* filename) {
+	ImVector<unsigned char> data;
+	if(!atlas->SaveBuildCacheToMemory(&data)) return false;
+	// Write a temporary file and rename it, a concurrent launch never maps a partial file
+	char tmp_filename[512];
+	snprintf(tmp_filename, sizeof(tmp_filename), "%s.tmp", filename);
+	FILE* f = fopen(tmp_filename, "wb");
+	if(f == NULL) {
+		fprintf(stderr, "FontCache: cannot open '%s'\n", tmp_filename);
+		return false;
+	}
+	bool ok = fwrite(data.Data, 1, (size_t)data.Size, f) == (size_t)data.Size;
+	ok = (fclose(f) == 0) && ok;
+#ifdef _WIN32
+	remove(filename);
+#endif
+	if(!ok || rename(tmp_filename, filename) != 0) {
+		fprintf(stderr, "FontCache: cannot write '%s'\n", filename);
+		remove(tmp_filename);
+		return false;
+	}
+	return true;
+}
+
+bool build_font_atlas_cached(ImFontAtlas* atlas, const char* filename) {
+	if(load_font_cache(atlas, filename)) return true;
+	atlas->Build();
+	save_font_cache(atlas, filename);
+	return false;
+}
@@ -0,0 +1,26 @@
+#ifndef FONTCACHE_H
+#define FONTCACHE_H
+
+#include "imgui.h"
+
+/*
+* Font atlas cache on disk
+*
+* Saves the result of ImFontAtlas::Build() to a file and restores it on the next
+* launches, which skips parsing, packing and rasterizing the fonts. The file is
+* mapped in memory (mmap) and only the texture and glyph tables are copied out.
+* The cache is keyed by the font data, sizes, glyph ranges and configs: when any
+* of them changes, or the file is missing or corrupt, the atlas is built normally
+* and the file is rewritten.
+*
+* Usage, after adding the fonts and before the first frame:
+*	build_font_atlas_cached(io.Fonts, "imgui_fonts.cache");
+*/
+
+bool load_font_cache(ImFontAtlas* atlas, const char* filename);
+bool save_font_cache(ImFontAtlas* atlas, const char* filename);
+
+// load_font_cache() or Build() + save_font_cache(), return true when the cache was used
+bool build_font_atlas_cached(ImFontAtlas* atlas, const char* filename);
+
+#endif
@@ -0,0 +1,310 @@
+#include "FrameProfiler.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+FrameProfiler profiler;
+
+FrameProfiler::FrameProfiler() :
+	current(0),
+	num_frames(0),
+	serial(0),
+	depth(0),
+	frame_open(false),
+	recording(false),
+	zone_cost(0),
+	ctx(NULL),
+	selected_serial(-1),
+	paused(false),
+	frame_callback(NULL),
+	frame_callback_user_data(NULL) {
+	memset(hook_ids, 0, sizeof(hook_ids));
+}
+
+int64_t FrameProfiler::now() {
+#ifdef _WIN32
+	static LARGE_INTEGER freq;
+	LARGE_INTEGER t;
+	if(freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&t);
+	return (int64_t)((double)t.QuadPart * 1000000000.0 / (double)freq.QuadPart);
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/*
+* ImGui phases: the Pre hook opens a zone, the matching Post hook closes it.
+* ImGui::Render() calls EndFrame() before its own RenderPre hook so the zones don't overlap.
+*/
+static const char* hook_zone_names[] = { "ImGui::NewFrame", "ImGui::NewFrame", "ImGui::EndFrame", "ImGui::EndFrame", "ImGui::Render", "ImGui::Render" };
+
+static void profiler_hook(ImGuiContext* ctx, ImGuiContextHook* hook) {
+	IM_UNUSED(ctx);
+	FrameProfiler* p = (FrameProfiler*)hook->UserData;
+	if((hook->Type & 1) == 0)	// ImGuiContextHookType_XXXPre
+		p->zone_begin(hook_zone_names[hook->Type]);
+	else
+		p->zone_end();
+}
+
+void FrameProfiler::install(ImGuiContext* _ctx) {
+	IM_ASSERT(ctx == NULL && _ctx != NULL);
+	ctx = _ctx;
+	for(int i = 0; i < 6; i++) {
+		ImGuiContextHook hook;
+		hook.Type = (ImGuiContextHookType)(ImGuiContextHookType_NewFramePre + i);
+		hook.Callback = profiler_hook;
+		hook.UserData = this;
+		hook_ids[i] = ImGui::AddContextHook(ctx, &hook);
+	}
+	calibrate();
+}
+
+void FrameProfiler::uninstall() {
+	if(ctx == NULL) return;
+	for(int i = 0; i < 6; i++)
+		ImGui::RemoveContextHook(ctx, hook_ids[i]);
+	ctx = NULL;
+}
+
+/*
+* Measure what recording one zone costs, to display the profiler's own overhead
+*/
+void FrameProfiler::calibrate() {
+	const int count = MAX_PROFILER_ZONES;
+	t_profiler_frame& f = frames[current];
+	f.num_zones = 0;
+	f.dropped = 0;
+	bool backup_recording = recording;
+	int64_t best = INT64_MAX;
+	recording = true;
+	for(int pass = 0; pass < 4; pass++) {
+		int64_t t0 = now();
+		for(int i = 0; i < count; i++) {
+			zone_begin("calibrate");
+			zone_end();
+		}
+		int64_t t = now() - t0;
+		if(t < best) best = t;
+		f.num_zones = 0;
+	}
+	recording = backup_recording;
+	zone_cost = best / count;
+}
+
+/*
+* Close the frame being recorded (if any) and start a new one.
+* Call once per main loop iteration, before anything else.
+*/
+void FrameProfiler::begin_frame() {
+	int64_t t = now();
+	if(frame_open) {
+		t_profiler_frame& f = frames[current];
+		while(depth > 0)
+			zone_pop();
+		f.end = t;
+		if(recording) {
+			if(frame_callback) frame_callback(f, frame_callback_user_data);
+			current = (current + 1) % MAX_PROFILER_FRAMES;
+			if(num_frames < MAX_PROFILER_FRAMES - 1) num_frames++;
+			serial++;	// only count frames committed to history, history() relies on consecutive serials
+		}
+	}
+	recording = !paused;
+	frame_open = true;
+	depth = 0;
+	t_profiler_frame& f = frames[current];
+	f.serial = serial;
+	f.start = t;
+	f.end = t;
+	f.num_zones = 0;
+	f.dropped = 0;
+}
+
+void FrameProfiler::zone_push(const char* name) {
+	t_profiler_frame& f = frames[current];
+	int index = -1;
+	if(f.num_zones < MAX_PROFILER_ZONES && depth < MAX_PROFILER_DEPTH) {
+		index = f.num_zones++;
+		t_profiler_zone& z = f.zones[index];
+		z.name = name;
+		z.depth = depth;
+		z.start = now();
+		z.end = z.start;
+	}
+	else {
+		f.dropped++;
+	}
+	if(depth < MAX_PROFILER_DEPTH) stack[depth] = index;
+	depth++;
+}
+
+void FrameProfiler::zone_pop() {
+	if(depth == 0) return;
+	depth--;
+	if(depth < MAX_PROFILER_DEPTH && stack[depth] >= 0)
+		frames[current].zones[stack[depth]].end = now();
+}
+
+const t_profiler_frame* FrameProfiler::history(int age) const {
+	if(age < 0 || age >= num_frames) return NULL;
+	return &frames[(current - 1 - age + MAX_PROFILER_FRAMES) % MAX_PROFILER_FRAMES];
+}
+
+/*
+* UI
+*/
+
+static ImU32 zone_color(const char* name) {
+	float hue = (float)(ImHashStr(name) & 0xFF) / 255.0f;
+	float r, g, b;
+	ImGui::ColorConvertHSVtoRGB(hue, 0.45f, 0.75f, r, g, b);
+	return ImGui::GetColorU32(ImVec4(r, g, b, 1.0f));
+}
+
+struct t_zone_stats {
+	const char* name;
+	int calls;
+	int frames;
+	double total_ms, max_ms;
+	int last_serial;
+};
+
+static float frame_time_getter(void* data, int idx) {
+	const FrameProfiler* p = (const FrameProfiler*)data;
+	const t_profiler_frame* f = p->history_at(idx);
+	return f ? (float)((f->end - f->start) / 1000000.0) : 0.0f;
+}
+
+void FrameProfiler::show_window(bool* p_open) {
+	if(!ImGui::Begin("Frame Profiler", p_open)) {
+		ImGui::End();
+		return;
+	}
+
+	const t_profiler_frame* latest = history(0);
+	if(latest == NULL) {
+		ImGui::TextDisabled("No complete frame recorded yet.");
+		ImGui::End();
+		return;
+	}
+
+	// Overhead of recording, from the calibrated cost of a zone
+	double frame_ms = (latest->end - latest->start) / 1000000.0;
+	double overhead_ms = latest->num_zones * (double)zone_cost / 1000000.0;
+	ImGui::Checkbox("Pause", &paused);
+	ImGui::SameLine();
+	ImGui::Text("%.3f ms/frame, %d zones, recording overhead ~%.1f us (%.2f%%)", frame_ms, latest->num_zones, overhead_ms * 1000.0, frame_ms > 0.0 ? overhead_ms * 100.0 / frame_ms : 0.0);
+
+	// Frame times, oldest to newest, click to select a frame
+	ImGui::PlotHistogram("##frametimes", frame_time_getter, this, num_frames, 0, "Frame time (ms), click to select", 0.0f, FLT_MAX, ImVec2(ImGui::GetContentRegionAvail().x, 60.0f));
+	if(ImGui::IsItemHovered() && ImGui::IsMouseClicked(0)) {
+		ImRect r(ImGui::GetItemRectMin(), ImGui::GetItemRectMax());
+		float t = ImClamp((ImGui::GetIO().MousePos.x - r.Min.x) / r.GetWidth(), 0.0f, 0.9999f);
+		const t_profiler_frame* f = history_at((int)(t * num_frames));
+		if(f) selected_serial = f->serial;
+	}
+
+	const t_profiler_frame* frame = latest;
+	if(selected_serial >= 0) {
+		const t_profiler_frame* f = history(latest->serial - selected_serial);
+		if(f && f->serial == selected_serial) frame = f;
+		else selected_serial = -1;
+	}
+	if(selected_serial >= 0) {
+		ImGui::Text("Frame %d", frame->serial);
+		ImGui::SameLine();
+		if(ImGui::SmallButton("Follow latest")) selected_serial = -1;
+	}
+	else {
+		ImGui::Text("Frame %d (latest)", frame->serial);
+	}
+	if(frame->dropped > 0) {
+		ImGui::SameLine();
+		ImGui::TextColored(ImVec4(1.0f, 0.4f, 0.4f, 1.0f), "%d zones dropped", frame->dropped);
+	}
+
+	// Flame graph: x = time within the frame, y = nesting depth
+	int max_depth = 0;
+	for(int i = 0; i < frame->num_zones; i++)
+		if(frame->zones[i].depth > max_depth) max_depth = frame->zones[i].depth;
+	const float row_h = ImGui::GetTextLineHeightWithSpacing();
+	ImVec2 canvas_size(ImGui::GetContentRegionAvail().x, row_h * (max_depth + 1));
+	ImVec2 p0 = ImGui::GetCursorScreenPos();
+	ImGui::InvisibleButton("##flamegraph", ImVec2(ImMax(canvas_size.x, 1.0f), canvas_size.y));
+	ImDrawList* draw_list = ImGui::GetWindowDrawList();
+	const double duration = (double)ImMax(frame->end - frame->start, (int64_t)1);
+	const ImVec2 mouse = ImGui::GetIO().MousePos;
+	const t_profiler_zone* hovered = NULL;
+	draw_list->PushClipRect(p0, ImVec2(p0.x + canvas_size.x, p0.y + canvas_size.y), true);
+	for(int i = 0; i < frame->num_zones; i++) {
+		const t_profiler_zone& z = frame->zones[i];
+		ImVec2 a(p0.x + (float)((z.start - frame->start) / duration) * canvas_size.x, p0.y + z.depth * row_h);
+		ImVec2 b(p0.x + (float)((z.end - frame->start) / duration) * canvas_size.x, a.y + row_h - 1.0f);
+		b.x = ImMax(b.x, a.x + 1.0f);
+		draw_list->AddRectFilled(a, b, zone_color(z.name));
+		if(b.x - a.x > 8.0f) {
+			ImVec4 clip(a.x, a.y, b.x - 2.0f, b.y);
+			draw_list->AddText(NULL, 0.0f, ImVec2(a.x + 2.0f, a.y + ImGui::GetStyle().ItemSpacing.y * 0.5f), IM_COL32_BLACK, z.name, NULL, 0.0f, &clip);
+		}
+		if(ImGui::IsItemHovered() && mouse.x >= a.x && mouse.x < b.x && mouse.y >= a.y && mouse.y < b.y)
+			hovered = &z;
+	}
+	draw_list->PopClipRect();
+	if(hovered)
+		ImGui::SetTooltip("%s\n%.3f ms (%.1f%% of frame)", hovered->name, (hovered->end - hovered->start) / 1000000.0, (hovered->end - hovered->start) * 100.0 / duration);
+
+	// Per-zone statistics over the whole history
+	if(ImGui::CollapsingHeader("Zones", ImGuiTreeNodeFlags_DefaultOpen)) {
+		t_zone_stats stats[64];
+		int num_stats = 0;
+		for(int age = 0; age < num_frames; age++) {
+			const t_profiler_frame* f = history(age);
+			for(int i = 0; i < f->num_zones; i++) {
+				const t_profiler_zone& z = f->zones[i];
+				int n = 0;
+				while(n < num_stats && stats[n].name != z.name && strcmp(stats[n].name, z.name) != 0) n++;
+				if(n == num_stats) {
+					if(num_stats == IM_ARRAYSIZE(stats)) continue;
+					t_zone_stats& s = stats[num_stats++];
+					s.name = z.name;
+					s.calls = s.frames = 0;
+					s.total_ms = s.max_ms = 0.0;
+					s.last_serial = -1;
+				}
+				t_zone_stats& s = stats[n];
+				double ms = (z.end - z.start) / 1000000.0;
+				s.calls++;
+				s.total_ms += ms;
+				if(ms > s.max_ms) s.max_ms = ms;
+				if(s.last_serial != f->serial) { s.frames++; s.last_serial = f->serial; }
+			}
+		}
+		if(ImGui::BeginTable("##zonestats", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit)) {
+			ImGui::TableSetupColumn("Zone", ImGuiTableColumnFlags_WidthStretch);
+			ImGui::TableSetupColumn("Avg ms/frame");
+			ImGui::TableSetupColumn("Max ms");
+			ImGui::TableSetupColumn("Calls/frame");
+			ImGui::TableHeadersRow();
+			for(int n = 0; n < num_stats; n++) {
+				const t_zone_stats& s = stats[n];
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn(); ImGui::TextUnformatted(s.name);
+				ImGui::TableNextColumn(); ImGui::Text("%.3f", s.total_ms / s.frames);
+				ImGui::TableNextColumn(); ImGui::Text("%.3f", s.max_ms);
+				ImGui::TableNextColumn(); ImGui::Text("%.1f", (double)s.calls / s.frames);
+			}
+			ImGui::EndTable();
+		}
+	}
+
+	ImGui::End();
+}
@@ -0,0 +1,110 @@
+#ifndef FRAMEPROFILER_H
+#define FRAMEPROFILER_H
+
+#include "imgui.h"
+#include <stdint.h>
+
+struct ImGuiContext;
+
+/*
+* Frame-phase CPU profiler
+*
+* Records nested zones with CLOCK_MONOTONIC timestamps (nanoseconds) into a fixed
+* history of frames, no allocation while recording. ImGui's own phases (NewFrame,
+* EndFrame, Render) are recorded through ImGuiContextHook, application code adds
+* its own zones with PROFILE_ZONE("name") or zone_begin()/zone_end() pairs.
+* Zone names must be string literals (only the pointer is stored).
+* Single threaded: call everything from the thread running the main loop.
+*
+* Usage:
+*	profiler.install(ImGui::GetCurrentContext());
+*	while(...) {
+*		profiler.begin_frame();
+*		{ PROFILE_ZONE("update"); update(); }
+*		...
+*	}
+*	profiler.show_window(&open);	// flame graph of the selected frame
+*/
+
+const int MAX_PROFILER_ZONES  = 128;	// zones recorded per frame, extra zones are counted as dropped
+const int MAX_PROFILER_FRAMES = 240;	// frames of history
+const int MAX_PROFILER_DEPTH  = 16;
+
+struct t_profiler_zone {
+	const char *name;
+	int64_t start, end;		// nanoseconds
+	int depth;
+};
+
+struct t_profiler_frame {
+	int serial;			// recorded frame number, consecutive in history (paused frames aren't counted)
+	int64_t start, end;
+	int num_zones;
+	int dropped;
+	t_profiler_zone zones[MAX_PROFILER_ZONES];
+};
+
+typedef void (*t_profiler_frame_callback)(const t_profiler_frame& frame, void* user_data);
+
+class FrameProfiler {
+private:
+	t_profiler_frame frames[MAX_PROFILER_FRAMES];
+	int current;			// index of the frame being recorded
+	int num_frames;			// complete frames in history
+	int serial;
+	int stack[MAX_PROFILER_DEPTH];	// zone indices, -1 for dropped zones
+	int depth;
+	bool frame_open;
+	bool recording;			// latched by begin_frame() so pausing never unbalances a frame
+	int64_t zone_cost;		// measured cost of one zone_begin()/zone_end() pair
+	ImGuiContext* ctx;
+	ImGuiID hook_ids[6];
+
+	// UI state
+	int selected_serial;		// -1 = latest frame
+
+	const t_profiler_frame* history(int age) const;	// 0 = latest complete frame
+	void calibrate();
+
+public:
+	bool paused;
+	t_profiler_frame_callback frame_callback;	// called by begin_frame() for each recorded frame, e.g. to export it
+	void* frame_callback_user_data;
+
+	FrameProfiler();
+
+	static int64_t now();
+
+	void install(ImGuiContext* _ctx);
+	void uninstall();
+
+	void begin_frame();
+	int frame_count() const { return num_frames; }
+	const t_profiler_frame* history_at(int idx) const { return history(num_frames - 1 - idx); }	// 0 = oldest
+
+	inline void zone_begin(const char* name) {
+		if(!recording) return;
+		zone_push(name);
+	}
+	inline void zone_end() {
+		if(!recording) return;
+		zone_pop();
+	}
+	void zone_push(const char* name);
+	void zone_pop();
+
+	void show_window(bool* p_open);
+};
+
+extern FrameProfiler profiler;
+
+struct ProfileZone {
+	ProfileZone(const char* name) { profiler.zone_begin(name); }
+	~ProfileZone() { profiler.zone_end(); }
+};
+
+#define PROFILE_CONCAT_(a, b)	a##b
+#define PROFILE_CONCAT(a, b)	PROFILE_CONCAT_(a, b)
+#define PROFILE_ZONE(name)	ProfileZone PROFILE_CONCAT(profile_zone_, __LINE__)(name)
+
+#endif
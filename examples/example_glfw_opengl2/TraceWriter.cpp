@@ -0,0 +1,237 @@
+#include "TraceWriter.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <string.h>
+
+TraceWriter trace;
+
+TraceWriter::TraceWriter() :
+	ring(NULL),
+	ring_head(0),
+	ring_count(0),
+	ring_capacity(0),
+	stream_close(false),
+	quit(false),
+	events_written(0),
+	streaming(false),
+	time_origin(0),
+	flight_seconds(10.0f) {
+	stream_filename[0] = 0;
+	dump_filename[0] = 0;
+}
+
+TraceWriter::~TraceWriter() {
+	IM_ASSERT(!thread.joinable() && "Call detach() before exiting");
+}
+
+void TraceWriter::attach(FrameProfiler* profiler) {
+	IM_ASSERT(profiler->frame_callback == NULL && !thread.joinable());
+	ring = NULL;
+	ring_head = ring_count = ring_capacity = 0;
+	grow_ring(MIN_FLIGHT_EVENTS);
+	time_origin = FrameProfiler::now();
+	quit = false;
+	thread = std::thread(&TraceWriter::writer_main, this);
+	profiler->frame_callback = frame_callback;
+	profiler->frame_callback_user_data = this;
+}
+
+void TraceWriter::detach(FrameProfiler* profiler) {
+	if(!thread.joinable()) return;
+	profiler->frame_callback = NULL;
+	profiler->frame_callback_user_data = NULL;
+	stop_stream();
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		quit = true;
+	}
+	cond.notify_one();
+	thread.join();
+	IM_FREE(ring);
+	ring = NULL;
+	ring_head = ring_count = ring_capacity = 0;
+	pending.clear();
+	dump_events.clear();
+	writing.clear();
+	dump_writing.clear();
+}
+
+void TraceWriter::start_stream(const char* filename) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		ImStrncpy(stream_filename, filename, IM_ARRAYSIZE(stream_filename));
+		stream_close = false;
+	}
+	streaming = true;
+	cond.notify_one();
+}
+
+void TraceWriter::stop_stream() {
+	if(!streaming) return;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stream_close = true;
+	}
+	streaming = false;
+	cond.notify_one();
+}
+
+void TraceWriter::grow_ring(int capacity) {
+	t_trace_event* new_ring = (t_trace_event*)IM_ALLOC(sizeof(t_trace_event) * capacity);
+	for(int i = 0; i < ring_count; i++)
+		new_ring[i] = ring[(ring_head + i) % ring_capacity];
+	if(ring) IM_FREE(ring);
+	ring = new_ring;
+	ring_head = 0;
+	ring_capacity = capacity;
+}
+
+void TraceWriter::push(const t_trace_event& e) {
+	// Full: grow instead of dropping the oldest event if it is still within flight_seconds
+	if(ring_count == ring_capacity && ring_capacity < MAX_FLIGHT_EVENTS && ring[ring_head].end >= e.end - (int64_t)(flight_seconds * 1000000000.0))
+		grow_ring(ImMin(ring_capacity * 2, MAX_FLIGHT_EVENTS));
+	int index = (ring_head + ring_count) % ring_capacity;
+	ring[index] = e;
+	if(ring_count < ring_capacity) ring_count++;
+	else ring_head = (ring_head + 1) % ring_capacity;
+}
+
+float TraceWriter::flight_covered_seconds() const {
+	if(ring == NULL || ring_count == 0) return 0.0f;
+	int64_t newest = ring[(ring_head + ring_count - 1) % ring_capacity].end;
+	int64_t oldest = ring[ring_head].start;
+	return ImMin(flight_seconds, (float)((newest - oldest) / 1000000000.0));
+}
+
+/*
+* Called by FrameProfiler::begin_frame() on the main thread for each complete frame
+*/
+void TraceWriter::frame_callback(const t_profiler_frame& frame, void* user_data) {
+	TraceWriter* w = (TraceWriter*)user_data;
+	t_trace_event frame_event;
+	frame_event.name = NULL;
+	frame_event.start = frame.start;
+	frame_event.end = frame.end;
+	frame_event.frame = frame.serial;
+
+	if(w->flight_seconds > 0.0f) {
+		w->push(frame_event);
+		for(int i = 0; i < frame.num_zones; i++) {
+			t_trace_event e = { frame.zones[i].name, frame.zones[i].start, frame.zones[i].end, frame.serial };
+			w->push(e);
+		}
+	}
+
+	if(w->streaming) {
+		{
+			std::lock_guard<std::mutex> lock(w->mutex);
+			w->pending.push_back(frame_event);
+			for(int i = 0; i < frame.num_zones; i++) {
+				t_trace_event e = { frame.zones[i].name, frame.zones[i].start, frame.zones[i].end, frame.serial };
+				w->pending.push_back(e);
+			}
+		}
+		w->cond.notify_one();
+	}
+}
+
+/*
+* Copy the last flight_seconds of events and hand them to the writer thread
+*/
+void TraceWriter::dump_flight_recorder(const char* filename) {
+	if(ring == NULL || ring_count == 0) return;
+	int64_t newest = ring[(ring_head + ring_count - 1) % ring_capacity].end;
+	int64_t oldest = newest - (int64_t)(flight_seconds * 1000000000.0);
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		dump_events.resize(0);
+		dump_events.reserve(ring_count);
+		for(int i = 0; i < ring_count; i++) {
+			const t_trace_event& e = ring[(ring_head + i) % ring_capacity];
+			if(e.end >= oldest) dump_events.push_back(e);
+		}
+		ImStrncpy(dump_filename, filename, IM_ARRAYSIZE(dump_filename));
+	}
+	cond.notify_one();
+}
+
+void TraceWriter::write_event(FILE* f, const t_trace_event& e, int64_t origin) {
+	double ts = (e.start - origin) / 1000.0;
+	double dur = (e.end - e.start) / 1000.0;
+	fputs(",\n", f);	// always preceded by the thread_name metadata event
+	if(e.name == NULL) {
+		fprintf(f, "{\"name\":\"Frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1,\"args\":{\"frame\":%d}}", ts, dur, e.frame);
+		return;
+	}
+	// Zone names are string literals, escape them anyway to always produce valid JSON
+	fputs("{\"name\":\"", f);
+	for(const char* p = e.name; *p; p++) {
+		if(*p == '"' || *p == '\\') fputc('\\', f);
+		if((unsigned char)*p >= 0x20) fputc(*p, f);
+	}
+	fprintf(f, "\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":1}", ts, dur);
+}
+
+static const char* trace_header = "[\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"main\"}}";
+
+void TraceWriter::writer_main() {
+	FILE* stream = NULL;
+	char open_name[256], dump_name[256];
+	std::unique_lock<std::mutex> lock(mutex);
+	for(;;) {
+		cond.wait(lock, [this] { return quit || pending.Size > 0 || stream_filename[0] || stream_close || dump_filename[0]; });
+		ImStrncpy(open_name, stream_filename, IM_ARRAYSIZE(open_name));
+		ImStrncpy(dump_name, dump_filename, IM_ARRAYSIZE(dump_name));
+		stream_filename[0] = dump_filename[0] = 0;
+		bool close = stream_close;
+		bool exit = quit;
+		stream_close = false;
+		writing.swap(pending);
+		if(dump_name[0]) dump_writing.swap(dump_events);
+		lock.unlock();
+
+		// File I/O without holding the lock
+		if(open_name[0]) {
+			if(stream) { fputs("\n]\n", stream); fclose(stream); }
+			if((stream = fopen(open_name, "w")) != NULL)
+				fputs(trace_header, stream);
+			else
+				fprintf(stderr, "TraceWriter: cannot open '%s'\n", open_name);
+		}
+		int count = 0;
+		if(stream) {
+			for(int i = 0; i < writing.Size; i++)
+				write_event(stream, writing[i], time_origin);
+			count += writing.Size;
+			fflush(stream);
+		}
+		writing.resize(0);
+		if(close && stream) {
+			fputs("\n]\n", stream);
+			fclose(stream);
+			stream = NULL;
+		}
+		if(dump_name[0]) {
+			if(FILE* f = fopen(dump_name, "w")) {
+				fputs(trace_header, f);
+				for(int i = 0; i < dump_writing.Size; i++)
+					write_event(f, dump_writing[i], time_origin);
+				fputs("\n]\n", f);
+				fclose(f);
+				count += dump_writing.Size;
+			}
+			else {
+				fprintf(stderr, "TraceWriter: cannot open '%s'\n", dump_name);
+			}
+			dump_writing.resize(0);
+		}
+
+		lock.lock();
+		events_written += count;
+		if(exit && pending.Size == 0) break;
+	}
+	if(stream) {
+		fputs("\n]\n", stream);
+		fclose(stream);
+	}
+}
@@ -0,0 +1,90 @@
+#ifndef TRACEWRITER_H
+#define TRACEWRITER_H
+
+#include "imgui.h"
+#include "FrameProfiler.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/*
+* Chrome trace_event export of FrameProfiler zones
+*
+* Frames recorded by the profiler are turned into "complete" (ph:"X") events,
+* which carry both the begin and end of a zone, plus one event for the frame itself.
+* Files are written by a background thread, the main thread only copies the events
+* of a frame into a buffer under a lock, once per frame. Open the files with
+* chrome://tracing or https://ui.perfetto.dev
+*
+* Two modes, usable together:
+* - streaming: every frame is appended to a file until stop_stream(). The closing
+*   bracket is optional in the JSON array format, so a crash still leaves a valid trace.
+* - flight recorder: the events of the last N seconds are kept in a ring buffer,
+*   dump_flight_recorder() writes them to a file on demand (e.g. after a spike).
+*   The ring grows when it would drop events younger than N seconds, up to
+*   MAX_FLIGHT_EVENTS: flight_covered_seconds() tells how much history it really holds.
+*/
+
+const int MIN_FLIGHT_EVENTS = 1 << 12;
+const int MAX_FLIGHT_EVENTS = 1 << 20;	// 32 MB, 30 seconds of 128 zones per frame at 240 fps
+
+struct t_trace_event {
+	const char *name;
+	int64_t start, end;	// nanoseconds, FrameProfiler::now()
+	int frame;		// frame serial, for the frame event itself (name == NULL)
+};
+
+class TraceWriter {
+private:
+	// Flight recorder ring buffer (main thread only)
+	t_trace_event* ring;
+	int ring_head, ring_count, ring_capacity;
+
+	// Shared with the writer thread, protected by mutex
+	std::thread thread;
+	std::mutex mutex;
+	std::condition_variable cond;
+	// Buffers are swapped between the two threads and only ever (re)allocated by the main thread,
+	// as ImGui::MemAlloc() and the allocation tracker are not thread-safe.
+	ImVector<t_trace_event> pending;	// events to stream
+	ImVector<t_trace_event> dump_events;	// flight recorder snapshot to write
+	ImVector<t_trace_event> writing;	// writer thread side of the swaps
+	ImVector<t_trace_event> dump_writing;
+	char stream_filename[256];		// non-empty: (re)open the stream file
+	char dump_filename[256];
+	bool stream_close;
+	bool quit;
+	int events_written;
+
+	bool streaming;			// main thread view of the stream state
+	int64_t time_origin;
+
+	void push(const t_trace_event& e);
+	void grow_ring(int capacity);
+	void writer_main();
+	static void write_event(FILE* f, const t_trace_event& e, int64_t origin);
+	static void frame_callback(const t_profiler_frame& frame, void* user_data);
+
+public:
+	float flight_seconds;		// length of the flight recorder history, 0 = disabled
+
+	TraceWriter();
+	~TraceWriter();
+
+	void attach(FrameProfiler* profiler);
+	void detach(FrameProfiler* profiler);
+
+	void start_stream(const char* filename);
+	void stop_stream();
+	bool is_streaming() const { return streaming; }
+	int written() { std::lock_guard<std::mutex> lock(mutex); return events_written; }
+
+	float flight_covered_seconds() const;	// history held by the flight recorder, at most flight_seconds
+	void dump_flight_recorder(const char* filename);
+};
+
+extern TraceWriter trace;
+
+#endif
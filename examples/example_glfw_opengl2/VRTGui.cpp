@@ -1,4 +1,6 @@
 #include "VRTGui.h"
+#include "FrameProfiler.h"
+#include "TraceWriter.h"
 
 
 //-----------------------------------------------------------------------------
@@ -170,6 +172,25 @@ void VRTGui::menu_default()
 		ImGui::MenuItem("Close");
 		ImGui::MenuItem("Save As...");
 		ImGui::MenuItem("Log", NULL, &menu.is_log);
+		ImGui::MenuItem("Metrics", NULL, &menu.is_metrics);
+		ImGui::MenuItem("Profiler", NULL, &menu.is_profiler);
+		if (ImGui::BeginMenu("Trace"))
+		{
+			if(ImGui::MenuItem("Stream to trace.json", NULL, trace.is_streaming())) {
+				if(trace.is_streaming()) trace.stop_stream();
+				else trace.start_stream("trace.json");
+			}
+			char label[64];
+			snprintf(label, sizeof(label), "Dump last %.1f seconds", trace.flight_covered_seconds());	// may be less than kept, until enough frames were recorded
+			if(ImGui::MenuItem(label, NULL, false, trace.flight_covered_seconds() > 0.0f)) {
+				char filename[64];
+				snprintf(filename, sizeof(filename), "flight_%d.json", ImGui::GetFrameCount());
+				trace.dump_flight_recorder(filename);
+			}
+			ImGui::SliderFloat("##seconds", &trace.flight_seconds, 0.0f, 30.0f, "Keep %.0f s");
+			ImGui::TextDisabled("%d events written", trace.written());
+			ImGui::EndMenu();
+		}
 		if(ImGui::MenuItem("Exit")) 
 			glfwSetWindowShouldClose(window,1);
 
@@ -203,7 +224,8 @@ void VRTGui::menu_default()
 	menu.is_about=false;
     }
 
-    if (ImGui::BeginPopupModal("Help"))
+    // Static contents: reuse the output of the frame which submitted them while the popup is not hovered or moved
+    if (ImGui::BeginPopupModal("Help", NULL, ImGuiWindowFlags_CacheDrawList))
     {
 	ImGui::Text("1999-2021 (c) Istvan Hauser, E-Mail: webHauser@gmail.com\nVRT Visualizer for Linux v1.5.0\n");
 	ImGui::Separator();
@@ -214,6 +236,8 @@ void VRTGui::menu_default()
     }
 
     if(menu.is_log) ShowExampleAppLog(&menu.is_log);
+    if(menu.is_metrics) ImGui::ShowMetricsWindow(&menu.is_metrics);
+    if(menu.is_profiler) profiler.show_window(&menu.is_profiler);
 }
 
 void VRTGui::render_menu() {
@@ -225,6 +249,7 @@ void VRTGui::render_statusbar() {}
 void VRTGui::render_movebar() {}
 
 void VRTGui::render() {
+	PROFILE_ZONE("VRTGui::render");
 	render_menu();
 	render_toolbar();
 	render_statusbar();
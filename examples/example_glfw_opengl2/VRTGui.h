@@ -3,44 +3,7 @@
 
 #include "imgui.h"
 #include <GLFW/glfw3.h>
-
-/*
-button: GLFW_MOUSE_BUTTON_LEFT, GLFW_MOUSE_BUTTON_RIGHT
-action: GLFW_PRESS, GLFW_RELEASE
-mods:   GLFW_MOD_SHIFT		0x0001
-mods:   GLFW_MOD_CONTROL	0x0002
-mods:   GLFW_MOD_ALT		0x0004
-mods:   GLFW_MOD_CONTROL	0x0008
-*/
-struct t_mouse_input {
-	int type;		// 0=mouse key, 1=mouse move
-	int action;		// 0=release, 1=press, 2=click (high level)
-	int button;		// 0=left,  1=right
-	int mods;
-	double x,y;		// mouse position
-};
-
-/*
-action: GLFW_PRESS, GLFW_REPEAT, GLFW_RELEASE
-mods:   GLFW_MOD_SHIFT		0x0001
-mods:   GLFW_MOD_CONTROL	0x0002
-mods:   GLFW_MOD_ALT		0x0004
-mods:   GLFW_MOD_CONTROL	0x0008
-*/
-struct t_keyboard_input {
-	int action;		// 0=release, 1=press, 2=click (high level)
-	int code;		// keyboard scancode with modifier keys
-	int mods;
-};
-
-struct t_event {
-	char what;	// k=keyboard, m=mouse
-	double time;	// timestamp
-	union {
-		struct t_mouse_input mouse;
-		struct t_keyboard_input keyboard;
-	} uni;
-};
+#include "EventRecognizer.h"
 
 enum EditorMode {
 	VISUALIZER,
@@ -73,6 +36,8 @@ public:
 
 	struct t_menu_flags {
 		bool is_log;
+		bool is_metrics;
+		bool is_profiler;
 		// Editor menu
 		bool is_editor[9];
 		// About menu
@@ -80,6 +45,8 @@ public:
 		
 		void clear() {
 			is_log=false;
+			is_metrics=false;
+			is_profiler=false;
 			// Editor menu
 			clear_editor_flags(NUM_EDITORS);
 			// About menu
@@ -9,13 +9,13 @@
 #include <GLFW/glfw3.h>
 
 #include "VRTGui.h"
-#include "CircularBuffer.h"
+#include "EventRecognizer.h"
+#include "FrameProfiler.h"
+#include "TraceWriter.h"
+#include "FontCache.h"
+#include "AllocTracker.h"
 
-#define CLICK_TIME 0.30
-#define KEY_TIME 0.40
-
-CircularBuffer<t_event> lo_level_events;
-CircularBuffer<t_event> hi_level_events;
+EventRecognizer events;
 
 VRTGui *gui;
 
@@ -50,53 +50,8 @@ void game_render(GLFWwindow* window) {
 * and generate higher level events
 */
 void process_input() {
-	static struct t_event event1, event2;
-	double wait_time;
-
-	switch(lo_level_events.size()) {
-	case 0:	break;
-	case 1: 
-		event1 = lo_level_events.elem(0);
-		wait_time = event1.what == 'm' ? CLICK_TIME : KEY_TIME;
-		if(glfwGetTime() - event1.time > wait_time) {
-			lo_level_events.removeFirst();
-			hi_level_events.insert(event1);
-		}
-		break;
-	default:
-		event1 = lo_level_events.elem(0);
-		event2 = lo_level_events.elem(1);
-		switch(event1.what) {
-		case 'm': 
-			if(event1.what==event2.what && 					// Mouse events
-			   event1.uni.mouse.type==0 && event2.uni.mouse.type==0 && 	// Mouse key events
-			   event1.uni.mouse.button==event2.uni.mouse.button && 		// Same Mouse buttons
-			   event1.uni.mouse.action==GLFW_PRESS && event2.uni.mouse.action==GLFW_RELEASE &&	// Press and Release in order
-			  (event2.time - event1.time <= CLICK_TIME) ) {			// Click detected
-				event2.uni.mouse.action = 2;
-				hi_level_events.insert(event2);
-			} else {
-				hi_level_events.insert(event1);
-				hi_level_events.insert(event2);
-			}
-			break;
-		case 'k':
-			if(event1.what==event2.what && 					// Keyboard events
-			   event1.uni.keyboard.code==event2.uni.keyboard.code &&	// Same keys
-			   event1.uni.keyboard.action==GLFW_PRESS && event2.uni.keyboard.action==GLFW_RELEASE && // Press and Release in order
-			  (event2.time - event1.time <= KEY_TIME) ) {			// Keypress detected
-				event2.uni.keyboard.action = 2;
-				hi_level_events.insert(event2);
-			} else {
-				hi_level_events.insert(event1);
-				hi_level_events.insert(event2);
-			}
-			break;
-		}
-		lo_level_events.removeFirst();
-		lo_level_events.removeFirst();
-		break;
-	} 
+	PROFILE_ZONE("process_input");
+	events.process(glfwGetTime());
 }
 
 /*
@@ -104,11 +59,8 @@ void process_input() {
 */
 void game_update() {
 	static struct t_event event;
-	if(hi_level_events.size() > 0) {
-		event = hi_level_events.elem(0);
+	if(events.next(event))
 		gui->print_event(event);
-		hi_level_events.removeFirst();
-	}
 }
 
 /*
@@ -116,15 +68,9 @@ void game_update() {
 * Adds the event to the low level event buffer
 */
 static void keyboard_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
-	static struct t_event event;
-	ImGuiIO& io = ImGui::GetIO();
-	if(!io.WantCaptureKeyboard) {
-		event.what = 'k';
-		event.time = glfwGetTime();
-		event.uni.keyboard.action = action;
-		event.uni.keyboard.code = scancode;
-		event.uni.keyboard.mods = mods;
-		lo_level_events.insert(event);
+	if(events.add_key(glfwGetTime(), scancode, action, mods)) {
+		profiler.zone_begin("input:key");	// instant marker in traces, for input latency
+		profiler.zone_end();
 	}
 }
 
@@ -133,17 +79,9 @@ static void keyboard_callback(GLFWwindow* window, int key, int scancode, int act
 * Adds the event to the low level event buffer
 */
 static void mouse_key_callback(GLFWwindow* window, int button, int action, int mods) {
-	static struct t_event event;
-	ImGuiIO& io = ImGui::GetIO();
-	if(!io.WantCaptureMouse) {
-		// Create and add event to low level buffer
-		event.what = 'm';
-		event.time = glfwGetTime();
-		event.uni.mouse.type   = 0;
-		event.uni.mouse.action = action;
-		event.uni.mouse.button = button;
-		event.uni.mouse.mods   = mods;
-		lo_level_events.insert(event);
+	if(events.add_mouse_button(glfwGetTime(), button, action, mods)) {
+		profiler.zone_begin("input:mouse_button");
+		profiler.zone_end();
 	}
 }
 
@@ -152,17 +90,7 @@ static void mouse_key_callback(GLFWwindow* window, int button, int action, int m
 * Adds the event to the low level event buffer
 */
 static void mouse_move_callback(GLFWwindow* window, double xpos, double ypos) {
-	static struct t_event event;
-	ImGuiIO& io = ImGui::GetIO();
-	if(!io.WantCaptureMouse) {
-		// Create and add event to low level buffer
-		event.what = 'm';
-		event.time = glfwGetTime();
-		event.uni.mouse.type = 1;
-		event.uni.mouse.x = xpos;
-		event.uni.mouse.y = ypos;
-		lo_level_events.insert(event);
-	}
+	events.add_mouse_move(glfwGetTime(), xpos, ypos);
 }
 
 /*
@@ -203,7 +131,10 @@ int main(void)
 	*/
 	
 	IMGUI_CHECKVERSION();
+	install_alloc_tracker();	// File->Metrics->Memory, before ImGui::CreateContext()
 	ImGui::CreateContext();
+	profiler.install(ImGui::GetCurrentContext());	// File->Profiler
+	trace.attach(&profiler);			// File->Trace, flight recorder of the last 10 seconds
 	ImGuiIO& io = ImGui::GetIO(); (void)io;
 	//io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
 	//io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
@@ -229,27 +160,42 @@ int main(void)
     //io.Fonts->AddFontFromFileTTF("../../misc/fonts/DroidSans.ttf", 16.0f);
     //io.Fonts->AddFontFromFileTTF("../../misc/fonts/ProggyTiny.ttf", 10.0f);
     //ImFont* font = io.Fonts->AddFontFromFileTTF("c:\\Windows\\Fonts\\ArialUni.ttf", 18.0f, NULL, io.Fonts->GetGlyphRangesJapanese());
+    // - With large glyph ranges, ImFontAtlasFlags_DynamicGlyphs only rasterizes ASCII at startup and the other glyphs the first time they are displayed.
+    //io.Fonts->Flags |= ImFontAtlasFlags_DynamicGlyphs;
+    // - With ImFontAtlasFlags_SDF, glyphs are stored as distance fields: text scaled with io.FontGlobalScale or ImDrawList::AddText() stays sharp without rebuilding the atlas.
+    //io.Fonts->Flags |= ImFontAtlasFlags_SDF;
     //IM_ASSERT(font != NULL);		
+
+	// Build the atlas from the cache of the previous launch, or build it and write the cache (fonts/configs changed, first launch)
+	build_font_atlas_cached(io.Fonts, "imgui_fonts.cache");
 	
     gui = new VRTGui(window);
 
     while (!glfwWindowShouldClose(window))
     {
+	profiler.begin_frame();
+
 	/*
 	* Render the Game
 	*/
+	profiler.zone_begin("game_render");
 	game_render(window);
+	profiler.zone_end();
 
         // Poll and handle events (inputs, window resize, etc.)
         // You can read the io.WantCaptureMouse, io.WantCaptureKeyboard flags to tell if dear imgui wants to use your inputs.
         // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application.
         // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application.
         // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
+        profiler.zone_begin("glfwPollEvents");
         glfwPollEvents();
+        profiler.zone_end();
 
         // Start the Dear ImGui frame
+        profiler.zone_begin("ImGui_ImplXXX_NewFrame");
         ImGui_ImplOpenGL2_NewFrame();
         ImGui_ImplGlfw_NewFrame();
+        profiler.zone_end();
         ImGui::NewFrame();
 		
 	/*
@@ -265,24 +211,32 @@ int main(void)
 	//if(++count & 0x0F) 
 	process_input();
 
+	profiler.zone_begin("game_update");
 	game_update();
+	profiler.zone_end();
 
         // If you are using this code with non-legacy OpenGL header/contexts (which you should not, prefer using imgui_impl_opengl3.cpp!!),
         // you may need to backup/reset/restore other state, e.g. for current shader using the commented lines below.
         //GLint last_program;
         //glGetIntegerv(GL_CURRENT_PROGRAM, &last_program);
         //glUseProgram(0);
+        profiler.zone_begin("ImGui_ImplOpenGL2_RenderDrawData");
         ImGui_ImplOpenGL2_RenderDrawData(ImGui::GetDrawData());
+        profiler.zone_end();
         //glUseProgram(last_program);
 
+        profiler.zone_begin("glfwSwapBuffers");
         glfwMakeContextCurrent(window);
         glfwSwapBuffers(window);
+        profiler.zone_end();
     }
 
     // Delete my gui
     delete gui;
 
     // Cleanup
+    trace.detach(&profiler);
+    profiler.uninstall();
     ImGui_ImplOpenGL2_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
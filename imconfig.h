@@ -54,6 +54,15 @@
 //---- Pack colors to BGRA8 instead of RGBA8 (to avoid converting from one to another)
 //#define IMGUI_USE_BGRA_PACKED_COLOR
 
+//---- Use a faster hash function for IDs (ImHashStr/ImHashData) instead of the default table-driven CRC32. Pick at most one.
+// Hashes are different from the default CRC32: ids stored in .ini data by a build using another engine (e.g. tables settings) won't be found.
+//#define IMGUI_USE_HASH_CRC32C         // Hardware CRC32-C. Requires SSE 4.2 (e.g. compile with -msse4.2).
+//#define IMGUI_USE_HASH_WYHASH         // Portable word-at-a-time multiply-mix hash (wyhash-style).
+
+//---- Use a hash table index for ImGuiStorage (O(1) queries and insertions) instead of a sorted vector (O(log N) queries, O(N) insertions).
+// Costs ~8 bytes per pair for the index. Iteration order of ImGuiStorage::Data becomes the insertion order.
+//#define IMGUI_USE_HASHED_STORAGE
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
@@ -93,7 +102,11 @@
 // Your renderer backend will need to support it (most example renderer backends support both 16/32-bit indices).
 // Another way to allow large meshes while keeping 16-bit indices is to handle ImDrawCmd::VtxOffset in your renderer.
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
+// Defining IMGUI_USE_32BIT_INDICES on the compiler command-line does the same (e.g. 'make IDX32=1' in examples/).
 //#define ImDrawIdx unsigned int
+#ifdef IMGUI_USE_32BIT_INDICES
+#define ImDrawIdx unsigned int
+#endif
 
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
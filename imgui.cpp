@@ -67,6 +67,7 @@ CODE
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer
 // [SECTION] ImGuiListClipper
+// [SECTION] ImGuiVariableListClipper
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
 // [SECTION] MAIN CODE (most of the code! lots of stuff, needs tidying up!)
@@ -793,6 +794,16 @@ CODE
 #include <stdint.h>     // intptr_t
 #endif
 
+// Hardware CRC32-C for ImHashData()/ImHashStr(), see IMGUI_USE_HASH_CRC32C in imconfig.h
+#ifdef IMGUI_USE_HASH_CRC32C
+#if defined(IMGUI_USE_HASH_WYHASH)
+#error "IMGUI_USE_HASH_CRC32C and IMGUI_USE_HASH_WYHASH are mutually exclusive."
+#elif !defined(__SSE4_2__) && !defined(__AVX__)
+#error "IMGUI_USE_HASH_CRC32C requires SSE 4.2 support (e.g. compile with -msse4.2, or /arch:AVX with Visual Studio)."
+#endif
+#include <nmmintrin.h>  // _mm_crc32_u64, _mm_crc32_u32, _mm_crc32_u8
+#endif
+
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
 #define IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS
@@ -940,6 +951,8 @@ static bool             UpdateWindowManualResize(ImGuiWindow* window, const ImVe
 static void             RenderWindowOuterBorders(ImGuiWindow* window);
 static void             RenderWindowDecorations(ImGuiWindow* window, const ImRect& title_bar_rect, bool title_bar_is_highlight, int resize_grip_count, const ImU32 resize_grip_col[4], float resize_grip_draw_size);
 static void             RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& title_bar_rect, const char* name, bool* p_open);
+static bool             UpdateWindowDrawListCacheKey(ImGuiWindow* window, const char* name, bool title_bar_is_highlight, const ImU32 resize_grip_col[4], bool decorations_in_parent);
+static void             SwapDrawListBuffers(ImDrawList* a, ImDrawList* b);
 
 // Viewports
 static void             UpdateViewportsNewFrame();
@@ -988,6 +1001,16 @@ static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
 
+// Allocation tag of the calling thread, see SetMemTag() and ImGuiAllocTracker.
+// Thread-local since allocations also happen on other threads (draw lists setup with PrepareDrawList(), ImFontAtlas::BuildParallelFor jobs).
+#if defined(_MSC_VER) && _MSC_VER < 1900
+static __declspec(thread) ImGuiMemTag GImMemTag = ImGuiMemTag_Misc;
+#elif defined(_MSC_VER) || __cplusplus >= 201103L
+static thread_local ImGuiMemTag GImMemTag = ImGuiMemTag_Misc;
+#else
+static __thread ImGuiMemTag GImMemTag = ImGuiMemTag_Misc;
+#endif
+
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO)
 //-----------------------------------------------------------------------------
@@ -1107,6 +1130,7 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigTextLayoutCache = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1116,6 +1140,10 @@ ImGuiIO::ImGuiIO()
     ClipboardUserData = NULL;
     ImeSetInputScreenPosFn = ImeSetInputScreenPosFn_DefaultImpl;
     ImeWindowHandle = NULL;
+    ParallelForFn = NULL;
+    ParallelForUserData = NULL;
+    BackgroundJobFn = NULL;
+    BackgroundJobUserData = NULL;
 
     // Input (NB: we already have memset zero the entire structure!)
     MousePos = ImVec2(-FLT_MAX, -FLT_MAX);
@@ -1499,6 +1527,109 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 }
 #endif // #ifdef IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
 
+#if defined(IMGUI_USE_HASH_CRC32C) || defined(IMGUI_USE_HASH_WYHASH)
+
+// Word-at-a-time hash engines (opt-in, see imconfig.h)
+// - IMGUI_USE_HASH_CRC32C: hardware CRC32-C (Castagnoli polynomial) via SSE 4.2, 8 bytes per instruction.
+// - IMGUI_USE_HASH_WYHASH: portable wyhash-style multiply-mix, 16 bytes per round.
+// Both produce different values than the default CRC32: IDs stored in .ini data (e.g. tables settings) won't match
+// between builds using different engines. Windows settings are stored by name and are not affected.
+// Loads are done with memcpy() so unaligned input is fine. Results assume a little-endian host.
+static inline ImU64 ImHashRead64(const unsigned char* p) { ImU64 v; memcpy(&v, p, 8); return v; }
+static inline ImU32 ImHashRead32(const unsigned char* p) { ImU32 v; memcpy(&v, p, 4); return v; }
+
+#ifdef IMGUI_USE_HASH_CRC32C
+ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+{
+    ImU64 crc = ~seed;
+    const unsigned char* data = (const unsigned char*)data_p;
+#if defined(_M_X64) || defined(__x86_64__)
+    for (; data_size >= 8; data_size -= 8, data += 8)
+        crc = _mm_crc32_u64(crc, ImHashRead64(data));
+#endif
+    ImU32 crc32 = (ImU32)crc;
+    for (; data_size >= 4; data_size -= 4, data += 4)
+        crc32 = _mm_crc32_u32(crc32, ImHashRead32(data));
+    while (data_size-- != 0)
+        crc32 = _mm_crc32_u8(crc32, *data++);
+    return ~crc32;
+}
+#else
+// 64x64->128 multiply, folded back to 64-bit (wyhash 'mum' + 'mix')
+static inline ImU64 ImHashMix64(ImU64 a, ImU64 b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t r = (__uint128_t)a * b;
+    return (ImU64)r ^ (ImU64)(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    ImU64 hi;
+    ImU64 lo = _umul128(a, b, &hi);
+    return lo ^ hi;
+#else
+    ImU64 ha = a >> 32, hb = b >> 32, la = (ImU32)a, lb = (ImU32)b;
+    ImU64 rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32);
+    ImU64 c = t < rl;
+    ImU64 lo = t + (rm1 << 32);
+    c += lo < t;
+    ImU64 hi = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+    return lo ^ hi;
+#endif
+}
+
+ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
+{
+    const ImU64 s0 = 0xa0761d6478bd642fULL, s1 = 0xe7037ed1a0b428dbULL, s2 = 0x8ebc6af09c88c6e3ULL;
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU64 h = ImHashMix64(seed ^ s0, s1);
+    ImU64 a, b;
+    if (data_size <= 16)
+    {
+        if (data_size >= 4)
+        {
+            const size_t mid = (data_size >> 3) << 2;
+            a = ((ImU64)ImHashRead32(data) << 32) | ImHashRead32(data + mid);
+            b = ((ImU64)ImHashRead32(data + data_size - 4) << 32) | ImHashRead32(data + data_size - 4 - mid);
+        }
+        else if (data_size > 0)
+        {
+            a = ((ImU64)data[0] << 16) | ((ImU64)data[data_size >> 1] << 8) | data[data_size - 1];
+            b = 0;
+        }
+        else
+        {
+            a = b = 0;
+        }
+    }
+    else
+    {
+        size_t n = data_size;
+        for (; n > 16; n -= 16, data += 16)
+            h = ImHashMix64(ImHashRead64(data) ^ s1, ImHashRead64(data + 8) ^ h);
+        a = ImHashRead64(data + n - 16);
+        b = ImHashRead64(data + n - 8);
+    }
+    h = ImHashMix64(ImHashMix64(a ^ s1, b ^ h) ^ s0 ^ data_size, s2);
+    return (ImGuiID)(h ^ (h >> 32));
+}
+#endif
+
+// Zero-terminated string hash, with support for ### to reset back to seed value
+// Hashing the suffix starting at the last "###" with the seed is equivalent to resetting the hash when reaching it.
+// Labels rarely contain '#' so memchr() quickly skips over them, the hash itself then runs over whole words.
+ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
+{
+    if (data_size == 0)
+        data_size = strlen(data_p);
+    const char* data_end = data_p + data_size;
+    const char* hash_begin = data_p;
+    for (const char* p = data_p; p < data_end && (p = (const char*)memchr(p, '#', (size_t)(data_end - p))) != NULL; p++)
+        if (p + 2 < data_end && p[1] == '#' && p[2] == '#')
+            hash_begin = p;
+    return ImHashData(hash_begin, (size_t)(data_end - hash_begin), seed);
+}
+
+#else // #if defined(IMGUI_USE_HASH_CRC32C) || defined(IMGUI_USE_HASH_WYHASH)
+
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -1524,7 +1655,7 @@ static const ImU32 GCrc32LookupTable[256] =
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// CRC32 pretty much randomly access 1KB: see IMGUI_USE_HASH_CRC32C/IMGUI_USE_HASH_WYHASH in imconfig.h for faster alternatives.
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
@@ -1540,7 +1671,6 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
 {
     seed = ~seed;
@@ -1569,6 +1699,8 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
     return ~crc;
 }
 
+#endif // #if defined(IMGUI_USE_HASH_CRC32C) || defined(IMGUI_USE_HASH_WYHASH)
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -1912,6 +2044,8 @@ void ImGui::ColorConvertHSVtoRGB(float h, float s, float v, float& out_r, float&
 // Helper: Key->value storage
 //-----------------------------------------------------------------------------
 
+#ifndef IMGUI_USE_HASHED_STORAGE
+
 // std::lower_bound but without the bullshit
 static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiStoragePair>& data, ImGuiID key)
 {
@@ -1935,6 +2069,102 @@ static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiSt
     return first;
 }
 
+static ImGuiStorage::ImGuiStoragePair* StorageFind(ImGuiStorage* storage, ImGuiID key)
+{
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(storage->Data, key);
+    return (it == storage->Data.end() || it->key != key) ? NULL : it;
+}
+
+// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
+static ImGuiStorage::ImGuiStoragePair* StorageFindOrInsert(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& default_pair)
+{
+    ImGuiStorage::ImGuiStoragePair* it = LowerBound(storage->Data, default_pair.key);
+    if (it == storage->Data.end() || it->key != default_pair.key)
+        it = storage->Data.insert(it, default_pair);
+    return it;
+}
+
+#else
+
+// Robin Hood hashing: on insertion, an entry further away from its home slot steals the slot of an entry closer to its own home.
+// This keeps probe sequences short and sorted by distance, so a query can stop as soon as it meets a closer entry.
+// Keys are often already hashes but may also be small sequential integers, hence the extra mixing.
+static inline int StorageSlotHome(ImGuiID key, int mask)
+{
+    ImU32 h = key * 0x9E3779B1u;
+    return (int)((h ^ (h >> 15)) & (ImU32)mask);
+}
+
+static void StorageIndexInsert(ImVector<ImGuiStorage::ImGuiStorageSlot>& slots, ImGuiStorage::ImGuiStorageSlot slot)
+{
+    const int mask = slots.Size - 1;
+    int pos = StorageSlotHome(slot.key, mask);
+    for (int dist = 0; ; pos = (pos + 1) & mask, dist++)
+    {
+        ImGuiStorage::ImGuiStorageSlot& cur = slots.Data[pos];
+        if (cur.idx == -1)
+        {
+            cur = slot;
+            return;
+        }
+        const int cur_dist = (pos - StorageSlotHome(cur.key, mask)) & mask;
+        if (cur_dist < dist)
+        {
+            ImSwap(cur, slot);
+            dist = cur_dist;
+        }
+    }
+}
+
+// Rebuild the index, keeping the load factor under 3/4
+static void StorageIndexRebuild(ImGuiStorage* storage, int min_count)
+{
+    int capacity = 16;
+    while (capacity * 3 < min_count * 4)
+        capacity <<= 1;
+    storage->Slots.resize(capacity);
+    memset(storage->Slots.Data, 0xFF, (size_t)storage->Slots.size_in_bytes()); // idx = -1
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        ImGuiStorage::ImGuiStorageSlot slot = { storage->Data[n].key, n };
+        StorageIndexInsert(storage->Slots, slot);
+    }
+    storage->SlotsIndexedCount = storage->Data.Size;
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFind(ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->SlotsIndexedCount != storage->Data.Size)
+        StorageIndexRebuild(storage, storage->Data.Size);
+    if (storage->Data.Size == 0)
+        return NULL;
+    const int mask = storage->Slots.Size - 1;
+    int pos = StorageSlotHome(key, mask);
+    for (int dist = 0; ; pos = (pos + 1) & mask, dist++)
+    {
+        const ImGuiStorage::ImGuiStorageSlot& cur = storage->Slots.Data[pos];
+        if (cur.idx == -1 || ((pos - StorageSlotHome(cur.key, mask)) & mask) < dist)
+            return NULL;
+        if (cur.key == key)
+            return &storage->Data.Data[cur.idx];
+    }
+}
+
+static ImGuiStorage::ImGuiStoragePair* StorageFindOrInsert(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& default_pair)
+{
+    if (ImGuiStorage::ImGuiStoragePair* it = StorageFind(storage, default_pair.key))
+        return it;
+    if ((storage->Data.Size + 1) * 4 > storage->Slots.Size * 3)
+        StorageIndexRebuild(storage, storage->Data.Size + 1);
+    ImGuiStorage::ImGuiStorageSlot slot = { default_pair.key, storage->Data.Size };
+    StorageIndexInsert(storage->Slots, slot);
+    storage->Data.push_back(default_pair);
+    storage->SlotsIndexedCount = storage->Data.Size;
+    return &storage->Data.back();
+}
+
+#endif // #ifndef IMGUI_USE_HASHED_STORAGE
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -1950,14 +2180,15 @@ void ImGuiStorage::BuildSortByKey()
     };
     if (Data.Size > 1)
         ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairCompareByID);
+#ifdef IMGUI_USE_HASHED_STORAGE
+    StorageIndexRebuild(this, Data.Size);
+#endif
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStoragePair* it = StorageFind(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -1967,27 +2198,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStoragePair* it = StorageFind(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStoragePair* it = StorageFind(const_cast<ImGuiStorage*>(this), key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -1997,30 +2221,17 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &StorageFindOrInsert(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_i = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2030,24 +2241,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_f = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_p = val;
+    StorageFindOrInsert(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2183,8 +2382,13 @@ void ImGuiTextBuffer::append(const char* str, const char* str_end)
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
+        // Keep the tag of the subsystem using the buffer, if any (e.g. settings)
+        ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+        if (backup_mem_tag == ImGuiMemTag_Misc)
+            ImGui::SetMemTag(ImGuiMemTag_TextBuffer);
         int new_capacity = Buf.Capacity * 2;
         Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+        ImGui::SetMemTag(backup_mem_tag);
     }
 
     Buf.resize(needed_sz);
@@ -2218,8 +2422,13 @@ void ImGuiTextBuffer::appendfv(const char* fmt, va_list args)
     const int needed_sz = write_off + len;
     if (write_off + len >= Buf.Capacity)
     {
+        // Keep the tag of the subsystem using the buffer, if any (e.g. settings)
+        ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+        if (backup_mem_tag == ImGuiMemTag_Misc)
+            ImGui::SetMemTag(ImGuiMemTag_TextBuffer);
         int new_capacity = Buf.Capacity * 2;
         Buf.reserve(needed_sz > new_capacity ? needed_sz : new_capacity);
+        ImGui::SetMemTag(backup_mem_tag);
     }
 
     Buf.resize(needed_sz);
@@ -2241,6 +2450,18 @@ static bool GetSkipItemForListClipping()
     return (g.CurrentTable ? g.CurrentTable->HostSkipItems : g.CurrentWindow->SkipItems);
 }
 
+// We create the union of the ClipRect and the scoring rect which at worst should be 1 page away from ClipRect
+static ImRect CalcListClippingRect(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    ImRect unclipped_rect = window->ClipRect;
+    if (g.NavMoveScoringItems)
+        unclipped_rect.Add(g.NavScoringRect);
+    if (g.NavJustMovedToId && window->NavLastIds[0] == g.NavJustMovedToId)
+        unclipped_rect.Add(ImRect(window->Pos + window->NavRectRel[0].Min, window->Pos + window->NavRectRel[0].Max)); // Could store and use NavJustMovedToRectRel
+    return unclipped_rect;
+}
+
 // Helper to calculate coarse clipping of large list of evenly sized items.
 // NB: Prefer using the ImGuiListClipper higher-level helper if you can! Read comments and instructions there on how those use this sort of pattern.
 // NB: 'items_count' is only used to clamp the result, if you don't know your count you can use INT_MAX
@@ -2261,13 +2482,7 @@ void ImGui::CalcListClipping(int items_count, float items_height, int* out_items
         return;
     }
 
-    // We create the union of the ClipRect and the scoring rect which at worst should be 1 page away from ClipRect
-    ImRect unclipped_rect = window->ClipRect;
-    if (g.NavMoveScoringItems)
-        unclipped_rect.Add(g.NavScoringRect);
-    if (g.NavJustMovedToId && window->NavLastIds[0] == g.NavJustMovedToId)
-        unclipped_rect.Add(ImRect(window->Pos + window->NavRectRel[0].Min, window->Pos + window->NavRectRel[0].Max)); // Could store and use NavJustMovedToRectRel
-
+    const ImRect unclipped_rect = CalcListClippingRect(window);
     const ImVec2 pos = window->DC.CursorPos;
     int start = (int)((unclipped_rect.Min.y - pos.y) / items_height);
     int end = (int)((unclipped_rect.Max.y - pos.y) / items_height);
@@ -2456,6 +2671,371 @@ bool ImGuiListClipper::Step()
     return false;
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiVariableListClipper
+//-----------------------------------------------------------------------------
+// Measured heights are kept per block of IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE items, only for blocks with a displayed item,
+// and summed per block in two Fenwick trees (node n, 1-based, covers blocks [n - (n & -n), n)): the sum of measured heights
+// and the number of measured items. With 'e' the height estimate, the offset of item n is Sum(n) + (n - Count(n)) * e,
+// which only ever increases with n, so the first visible item can be found by descending the trees then scanning a block.
+// The estimate itself is never stored in the trees, so it can change from frame to frame at no cost.
+//-----------------------------------------------------------------------------
+
+#define IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE  64
+
+ImGuiVariableListClipper::ImGuiVariableListClipper()
+{
+    DisplayStart = DisplayEnd = 0;
+    ItemsCount = -1;
+    StepNo = 0;
+    ItemsFrozen = 0;
+    ItemsHeightEstimate = -1.0f;
+    StartPosY = ItemStartPosY = ClipMaxY = 0.0f;
+    DisplayExtraItem = false;
+    MeasuredHeightsSum = 0.0;
+    MeasuredCount = 0;
+    HeightsCount = 0;
+}
+
+ImGuiVariableListClipper::~ImGuiVariableListClipper()
+{
+    IM_ASSERT(ItemsCount == -1 && "Forgot to call End(), or to Step() until false?");
+    for (int block_n = 0; block_n < BlocksHeights.Size; block_n++)
+        IM_FREE(BlocksHeights[block_n]);
+}
+
+// Measured height of an item, -1.0f if never displayed
+static float VariableListClipperGetHeight(const ImGuiVariableListClipper* clipper, int item_n)
+{
+    const float* block = clipper->BlocksHeights[item_n / IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE];
+    return block ? block[item_n % IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE] : -1.0f;
+}
+
+// Sum of measured heights and number of measured items in blocks [0, blocks_n)
+static void VariableListClipperBlocksPrefix(const ImGuiVariableListClipper* clipper, int blocks_n, double* out_sum, int* out_count)
+{
+    double sum = 0.0;
+    int count = 0;
+    for (int n = blocks_n; n > 0; n -= (n & -n))
+    {
+        sum += clipper->TreeHeightsSums[n - 1];
+        count += clipper->TreeMeasuredCounts[n - 1];
+    }
+    *out_sum = sum;
+    *out_count = count;
+}
+
+// Sum of measured heights and number of measured items in [0, items_n)
+static void VariableListClipperPrefix(const ImGuiVariableListClipper* clipper, int items_n, double* out_sum, int* out_count)
+{
+    const int block_n = items_n / IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE;
+    VariableListClipperBlocksPrefix(clipper, block_n, out_sum, out_count);
+    if (const float* block = (block_n < clipper->BlocksHeights.Size) ? clipper->BlocksHeights[block_n] : NULL)
+        for (int i = 0; i < items_n % IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE; i++)
+            if (block[i] >= 0.0f)
+            {
+                *out_sum += block[i];
+                *out_count += 1;
+            }
+}
+
+static float VariableListClipperGetEstimate(const ImGuiVariableListClipper* clipper)
+{
+    if (clipper->ItemsHeightEstimate > 0.0f)
+        return clipper->ItemsHeightEstimate;
+    if (clipper->MeasuredCount > 0)
+        return (float)(clipper->MeasuredHeightsSum / clipper->MeasuredCount);
+    return ImGui::GetTextLineHeightWithSpacing();
+}
+
+static double VariableListClipperGetOffset(const ImGuiVariableListClipper* clipper, int item_n, float estimate)
+{
+    double sum;
+    int count;
+    VariableListClipperPrefix(clipper, item_n, &sum, &count);
+    return sum + (double)(item_n - count) * estimate;
+}
+
+// Last item starting at or before 'offset', in O(log N + block size)
+static int VariableListClipperFindItem(const ImGuiVariableListClipper* clipper, double offset, float estimate)
+{
+    // Last block starting at or before 'offset'. Blocks before the last one are full.
+    const int size = clipper->BlocksHeights.Size - 1;
+    int step = 1;
+    while (step <= size / 2)
+        step *= 2;
+    int n = 0;
+    double sum = 0.0;
+    int count = 0;
+    for (; step > 0; step >>= 1)
+    {
+        const int next = n + step;
+        if (next > size)
+            continue;
+        const double next_sum = sum + clipper->TreeHeightsSums[next - 1];
+        const int next_count = count + clipper->TreeMeasuredCounts[next - 1];
+        if (next_sum + (double)(next * IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE - next_count) * estimate <= offset)
+        {
+            n = next;
+            sum = next_sum;
+            count = next_count;
+        }
+    }
+
+    // Last item of the block starting at or before 'offset'
+    int item_n = n * IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE;
+    const int item_end = ImMin(item_n + IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE, clipper->HeightsCount);
+    double item_offset = sum + (double)(item_n - count) * estimate;
+    for (; item_n + 1 < item_end; item_n++)
+    {
+        const float height = VariableListClipperGetHeight(clipper, item_n);
+        item_offset += (height >= 0.0f) ? height : estimate;
+        if (item_offset > offset)
+            break;
+    }
+    return item_n;
+}
+
+static void VariableListClipperAddToTree(ImGuiVariableListClipper* clipper, int block_n, double delta_sum, int delta_count)
+{
+    clipper->MeasuredHeightsSum += delta_sum;
+    clipper->MeasuredCount += delta_count;
+    for (int n = block_n + 1; n <= clipper->BlocksHeights.Size; n += (n & -n))
+    {
+        clipper->TreeHeightsSums[n - 1] += delta_sum;
+        clipper->TreeMeasuredCounts[n - 1] += delta_count;
+    }
+}
+
+static void VariableListClipperSetHeight(ImGuiVariableListClipper* clipper, int item_n, float height)
+{
+    const int block_n = item_n / IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE;
+    float* block = clipper->BlocksHeights[block_n];
+    if (block == NULL)
+    {
+        block = clipper->BlocksHeights[block_n] = (float*)IM_ALLOC(sizeof(float) * IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE);
+        for (int i = 0; i < IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE; i++)
+            block[i] = -1.0f;
+    }
+    float* p_height = &block[item_n % IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE];
+    if (*p_height == height)
+        return;
+    const double delta_sum = height - (*p_height >= 0.0f ? *p_height : 0.0f);
+    const int delta_count = (*p_height >= 0.0f) ? 0 : 1;
+    *p_height = height;
+    VariableListClipperAddToTree(clipper, block_n, delta_sum, delta_count);
+}
+
+// Appending items is O(k / block size + log^2 N): new nodes only cover old (measured) blocks when they straddle the old size.
+static void VariableListClipperResize(ImGuiVariableListClipper* clipper, int items_count)
+{
+    const int old_count = clipper->HeightsCount;
+    const int old_blocks = clipper->BlocksHeights.Size;
+    const int new_blocks = (items_count + IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE - 1) / IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE;
+    clipper->HeightsCount = items_count;
+    if (items_count < old_count)
+    {
+        // Forget the heights of removed items, free the blocks past the end
+        for (int block_n = items_count / IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE; block_n < old_blocks; block_n++)
+        {
+            float* block = clipper->BlocksHeights[block_n];
+            if (block == NULL)
+                continue;
+            for (int i = ImMax(items_count - block_n * IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE, 0); i < IMGUI_VARIABLE_LIST_CLIPPER_BLOCK_SIZE; i++)
+                if (block[i] >= 0.0f)
+                {
+                    VariableListClipperAddToTree(clipper, block_n, -block[i], -1);
+                    block[i] = -1.0f;
+                }
+            if (block_n >= new_blocks)
+                IM_FREE(block);
+        }
+        clipper->BlocksHeights.resize(new_blocks);
+        clipper->TreeHeightsSums.resize(new_blocks);
+        clipper->TreeMeasuredCounts.resize(new_blocks);
+        return;
+    }
+
+    double old_sum;
+    int old_measured;
+    VariableListClipperBlocksPrefix(clipper, old_blocks, &old_sum, &old_measured);
+    clipper->BlocksHeights.resize(new_blocks, NULL);
+    clipper->TreeHeightsSums.resize(new_blocks, 0.0);
+    clipper->TreeMeasuredCounts.resize(new_blocks, 0);
+    for (int n = old_blocks + 1; n <= new_blocks; n++)
+    {
+        const int first = n - (n & -n);
+        if (first >= old_blocks)
+            continue;
+        double first_sum;
+        int first_measured;
+        VariableListClipperBlocksPrefix(clipper, first, &first_sum, &first_measured);
+        clipper->TreeHeightsSums[n - 1] = old_sum - first_sum;
+        clipper->TreeMeasuredCounts[n - 1] = old_measured - first_measured;
+    }
+}
+
+void ImGuiVariableListClipper::Begin(int items_count, float items_height_estimate)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    IM_ASSERT(ItemsCount == -1 && "Forgot to call End(), or to Step() until false?");
+    IM_ASSERT(items_count >= 0 && items_count < INT_MAX && "ImGuiVariableListClipper needs to know the number of items");
+
+    if (ImGuiTable* table = g.CurrentTable)
+        if (table->IsInsideRow)
+            ImGui::TableEndRow(table);
+
+    if (items_count != HeightsCount)
+        VariableListClipperResize(this, items_count);
+    StartPosY = ItemStartPosY = window->DC.CursorPos.y;
+    ItemsHeightEstimate = items_height_estimate;
+    ItemsCount = items_count;
+    ItemsFrozen = 0;
+    StepNo = 0;
+    DisplayStart = -1;
+    DisplayEnd = 0;
+}
+
+void ImGuiVariableListClipper::End()
+{
+    if (ItemsCount < 0) // Already ended
+        return;
+
+    // Seek to the end of the list, skipping the items below the clipping rectangle
+    if (StepNo == 1 && DisplayEnd < ItemsCount)
+    {
+        const float estimate = VariableListClipperGetEstimate(this);
+        const double offset = VariableListClipperGetOffset(this, ItemsCount, estimate) - VariableListClipperGetOffset(this, ItemsFrozen, estimate);
+        SetCursorPosYAndSetupForPrevLine(StartPosY + (float)offset, estimate);
+    }
+    ItemsCount = -1;
+    StepNo = 2;
+}
+
+bool ImGuiVariableListClipper::Step()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+
+    ImGuiTable* table = g.CurrentTable;
+    if (table && table->IsInsideRow)
+        ImGui::TableEndRow(table);
+
+    // Measure the item submitted by the previous step
+    if (DisplayStart >= 0 && DisplayEnd == DisplayStart + 1)
+    {
+        const float height = table ? (table->RowPosY2 - table->RowPosY1) : (window->DC.CursorPos.y - ItemStartPosY); // Using row bounds to handle the row unfreezing
+        VariableListClipperSetHeight(this, DisplayStart, ImMax(height, 0.0f));
+    }
+
+    // No items
+    if (ItemsCount == 0 || GetSkipItemForListClipping())
+    {
+        End();
+        return false;
+    }
+
+    // Step 0: while we are in frozen row state, keep displaying items one by one, unclipped.
+    // Then find the first visible item and position the cursor before it.
+    if (StepNo == 0)
+    {
+        if (table != NULL && !table->IsUnfrozenRows && ItemsFrozen < ItemsCount)
+        {
+            DisplayStart = ItemsFrozen;
+            DisplayEnd = ItemsFrozen + 1;
+            ItemsFrozen++;
+            ItemStartPosY = window->DC.CursorPos.y;
+            return true;
+        }
+        if (ItemsFrozen >= ItemsCount)
+        {
+            End();
+            return false;
+        }
+
+        StartPosY = window->DC.CursorPos.y;
+        int start = ItemsFrozen;
+        if (g.LogEnabled)
+        {
+            // If logging is active, do not perform any clipping
+            ClipMaxY = FLT_MAX;
+            DisplayExtraItem = false;
+        }
+        else
+        {
+            const ImRect unclipped_rect = CalcListClippingRect(window);
+            const float estimate = VariableListClipperGetEstimate(this);
+            const double frozen_offset = VariableListClipperGetOffset(this, ItemsFrozen, estimate);
+            start = ImMax(VariableListClipperFindItem(this, frozen_offset + (unclipped_rect.Min.y - StartPosY), estimate), ItemsFrozen);
+
+            // When performing a navigation request, ensure we have one item extra in the direction we are moving to
+            if (g.NavMoveScoringItems && g.NavMoveClipDir == ImGuiDir_Up)
+                start = ImMax(start - 1, ItemsFrozen);
+            ClipMaxY = unclipped_rect.Max.y;
+            DisplayExtraItem = (g.NavMoveScoringItems && g.NavMoveClipDir == ImGuiDir_Down);
+
+            // Seek cursor
+            if (start > ItemsFrozen)
+            {
+                const double offset = VariableListClipperGetOffset(this, start, estimate) - frozen_offset;
+                const float prev_height = VariableListClipperGetHeight(this, start - 1);
+                SetCursorPosYAndSetupForPrevLine(StartPosY + (float)offset, (prev_height >= 0.0f) ? prev_height : estimate);
+            }
+        }
+        DisplayStart = start;
+        DisplayEnd = start + 1;
+        ItemStartPosY = window->DC.CursorPos.y;
+        StepNo = 1;
+        return true;
+    }
+
+    // Step 1: display the next item until the cursor goes past the clipping rectangle, then seek to the end of the list
+    if (StepNo == 1)
+    {
+        if (DisplayEnd >= ItemsCount)
+        {
+            End();
+            return false;
+        }
+        if (window->DC.CursorPos.y >= ClipMaxY)
+        {
+            if (!DisplayExtraItem)
+            {
+                End();
+                return false;
+            }
+            DisplayExtraItem = false;
+        }
+        DisplayStart = DisplayEnd;
+        DisplayEnd = DisplayStart + 1;
+        ItemStartPosY = window->DC.CursorPos.y;
+        return true;
+    }
+
+    return false;
+}
+
+float ImGuiVariableListClipper::GetItemOffsetY(int item_n)
+{
+    IM_ASSERT(item_n >= 0 && item_n <= HeightsCount);
+    return (float)VariableListClipperGetOffset(this, item_n, VariableListClipperGetEstimate(this));
+}
+
+void ImGuiVariableListClipper::ClearHeights()
+{
+    const int items_count = HeightsCount;
+    for (int block_n = 0; block_n < BlocksHeights.Size; block_n++)
+        IM_FREE(BlocksHeights[block_n]);
+    BlocksHeights.clear();
+    HeightsCount = 0;
+    TreeHeightsSums.clear();
+    TreeMeasuredCounts.clear();
+    MeasuredHeightsSum = 0.0;
+    MeasuredCount = 0;
+    VariableListClipperResize(this, items_count);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -2812,7 +3392,7 @@ void ImGui::RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min, con
         // min   max   ellipsis_max
         //          <-> this is generally some padding value
 
-        const ImFont* font = draw_list->_Data->Font;
+        ImFont* font = draw_list->_Data->Font;
         const float font_size = draw_list->_Data->FontSize;
         const char* text_end_ellipsis = NULL;
 
@@ -2823,7 +3403,7 @@ void ImGui::RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min, con
             ellipsis_char = font->DotChar;
             ellipsis_char_count = 3;
         }
-        const ImFontGlyph* glyph = font->FindGlyph(ellipsis_char);
+        const ImFontGlyph* glyph = font->LoadGlyph(ellipsis_char);
 
         float ellipsis_glyph_width = glyph->X1;                 // Width of the glyph with no padding on either side
         float ellipsis_total_width = ellipsis_glyph_width;      // Full width of entire ellipsis
@@ -2934,7 +3514,7 @@ void ImGui::RenderNavHighlight(const ImRect& bb, ImGuiID id, ImGuiNavHighlightFl
 //-----------------------------------------------------------------------------
 
 // ImGuiWindow is mostly a dumb struct. It merely has a constructor and a few helper methods
-ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name) : DrawListInst(NULL)
+ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name) : DrawListInst(NULL), DrawListCache(NULL)
 {
     memset(this, 0, sizeof(*this));
     Name = ImStrdup(name);
@@ -2955,6 +3535,8 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name) : DrawListInst
     DrawList = &DrawListInst;
     DrawList->_Data = &context->DrawListSharedData;
     DrawList->_OwnerName = Name;
+    DrawListCache._Data = &context->DrawListSharedData;
+    DrawListCache._OwnerName = Name;
 }
 
 ImGuiWindow::~ImGuiWindow()
@@ -3065,6 +3647,10 @@ void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
     window->DrawList->_ClearFreeMemory();
+    window->DrawListCache._ClearFreeMemory();
+    window->DrawListCacheTitle.clear();
+    window->DrawListCacheValid = false;
+    window->DrawListCacheUsed = false;
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
@@ -3362,7 +3948,10 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
-        ctx->IO.MetricsActiveAllocations++;
+    {
+        ImAtomicAdd(&ctx->IO.MetricsActiveAllocations, 1);
+        ImAtomicAdd(&ctx->MemAllocCount, 1);
+    }
     return (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 }
 
@@ -3371,10 +3960,308 @@ void ImGui::MemFree(void* ptr)
 {
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
-            ctx->IO.MetricsActiveAllocations--;
+        {
+            ImAtomicAdd(&ctx->IO.MetricsActiveAllocations, -1);
+            ImAtomicAdd(&ctx->MemFreeCount, 1);
+        }
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+// Transient allocation which doesn't need to be freed: it is released by the next NewFrame().
+// Use for temporary buffers which would otherwise be allocated and freed within the frame.
+void* ImGui::MemAllocFrame(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    return g.FrameArena.Alloc(size);
+}
+
+void* ImGuiFrameArena::Alloc(size_t size)
+{
+    const int FRAME_ARENA_MIN_BLOCK_SIZE = 4096;
+    size = IM_MEMALIGN(size, 16);
+    IM_ASSERT(size < 0x7FFFFFFF);
+    if (Blocks.Size == 0 || CurrBlockUsed + (int)size > CurrBlockSize)
+    {
+        CurrBlockSize = ImMax(ImMax((int)size, CurrBlockSize * 2), FRAME_ARENA_MIN_BLOCK_SIZE); // Overflow blocks grow geometrically
+        CurrBlockUsed = 0;
+        Blocks.push_back((char*)IM_ALLOC((size_t)CurrBlockSize));
+        if (Blocks.Size == 1)
+            BlockSize = CurrBlockSize;
+    }
+    void* ptr = Blocks.back() + CurrBlockUsed;
+    CurrBlockUsed += (int)size;
+    FrameUsed += (int)size;
+    HighWater = ImMax(HighWater, FrameUsed);
+    return ptr;
+}
+
+void ImGuiFrameArena::Reset()
+{
+    const int FRAME_ARENA_SHRINK_CHECK_FRAMES = 256;
+    LastFrameUsed = FrameUsed;
+    RecentPeak = ImMax(RecentPeak, FrameUsed);
+    RecentFrames++;
+
+    // Replace overflowed blocks with a single block, or shrink the main block if it has been mostly unused for a while
+    int new_block_size = 0;
+    if (Blocks.Size > 1)
+        new_block_size = FrameUsed;
+    else if (RecentFrames >= FRAME_ARENA_SHRINK_CHECK_FRAMES && BlockSize > 4096 && RecentPeak * 4 < BlockSize)
+        new_block_size = RecentPeak;
+    if (new_block_size > 0)
+    {
+        Clear();
+        new_block_size = ImMax(IM_MEMALIGN(new_block_size + new_block_size / 4, 4096), 4096);
+        Blocks.push_back((char*)IM_ALLOC((size_t)new_block_size));
+        BlockSize = CurrBlockSize = new_block_size;
+    }
+    if (RecentFrames >= FRAME_ARENA_SHRINK_CHECK_FRAMES)
+        RecentPeak = RecentFrames = 0;
+    CurrBlockUsed = FrameUsed = 0;
+}
+
+void ImGuiFrameArena::Clear()
+{
+    for (int n = 0; n < Blocks.Size; n++)
+        IM_FREE(Blocks[n]);
+    Blocks.clear();
+    BlockSize = CurrBlockSize = CurrBlockUsed = FrameUsed = 0;
+}
+
+ImGuiTextLayoutEntry* ImGuiTextLayoutCache::GetEntry(const ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    if (Entries.Size == 0)
+    {
+        Entries.resize(IM_TEXT_LAYOUT_CACHE_SETS * IM_TEXT_LAYOUT_CACHE_WAYS);
+        memset(Entries.Data, 0, (size_t)Entries.size_in_bytes());
+    }
+
+    // Key on the text address rather than hashing its contents: hashing costs about as much as measuring the text.
+    // Labels are mostly literals or long-lived buffers, the contents are compared on hit to catch reused buffers.
+    const int text_len = (int)(text_end - text);
+    ImU32 size_bits, wrap_bits;
+    memcpy(&size_bits, &font_size, sizeof(size_bits));
+    memcpy(&wrap_bits, &wrap_width, sizeof(wrap_bits));
+    ImU64 key64 = (ImU64)(size_t)text ^ ((ImU64)(size_t)font << 7) ^ ((ImU64)text_len * 0x9E3779B97F4A7C15ULL) ^ ((ImU64)size_bits * 0x85EBCA77U) ^ ((ImU64)wrap_bits << 32);
+    key64 ^= key64 >> 29; key64 *= 0xBF58476D1CE4E5B9ULL; key64 ^= key64 >> 32;
+    const ImGuiID key = (ImGuiID)key64 | 1;
+
+    ImGuiTextLayoutEntry* set = &Entries.Data[(key % IM_TEXT_LAYOUT_CACHE_SETS) * IM_TEXT_LAYOUT_CACHE_WAYS];
+    ImGuiTextLayoutEntry* lru = set;
+    Tick++;
+    for (int n = 0; n < IM_TEXT_LAYOUT_CACHE_WAYS; n++)
+    {
+        ImGuiTextLayoutEntry* entry = &set[n];
+        if (entry->Key == key && entry->TextPtr == text && entry->Text.Size == text_len && entry->Font == font && entry->FontSize == font_size && entry->WrapWidth == wrap_width)
+        {
+            if (memcmp(entry->Text.Data, text, (size_t)text_len) == 0)
+            {
+                entry->LastUsed = Tick;
+                return entry;
+            }
+            lru = entry; // Same buffer with new contents: replace
+            break;
+        }
+        if (entry->LastUsed < lru->LastUsed)
+            lru = entry;
+    }
+
+    // Replace the least recently used entry of the set, keeping its buffers
+    if (lru->Key != 0)
+        Stats.Evictions++;
+    lru->Key = key;
+    lru->TextPtr = text;
+    lru->Text.resize(text_len);
+    memcpy(lru->Text.Data, text, (size_t)text_len);
+    lru->Font = font;
+    lru->FontSize = font_size;
+    lru->WrapWidth = wrap_width;
+    lru->CreatedFrame = GImGui->FrameCount;
+    lru->LastUsed = Tick;
+    lru->HasSize = lru->HasQuads = false;
+    lru->Quads.resize(0);
+    return lru;
+}
+
+void ImGuiTextLayoutCache::NewFrame(bool enabled, const ImFontAtlas* atlas)
+{
+    StatsLastFrame = Stats;
+    Stats = ImGuiTextLayoutCacheStats();
+    if (!enabled || FontAtlasBuildCount != atlas->BuildCount)
+        Clear();
+    FontAtlasBuildCount = atlas->BuildCount;
+}
+
+void ImGuiTextLayoutCache::Clear()
+{
+    for (int n = 0; n < Entries.Size; n++)
+    {
+        Entries[n].Text.clear();
+        Entries[n].Quads.clear();
+    }
+    Entries.clear();
+    if (ScratchDrawList)
+        IM_DELETE(ScratchDrawList);
+    ScratchDrawList = NULL;
+}
+
+ImGuiTextWrapEntry* ImGuiTextWrapCache::GetEntry(const ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end)
+{
+    ImGuiContext& g = *GImGui;
+    const int text_len = (int)(text_end - text);
+    ImGuiTextWrapEntry* entry = NULL;
+    ImGuiTextWrapEntry* unused_entry = NULL;   // Entry of the same text with other layout parameters, not used during this frame
+    for (int n = 0; n < Entries.Size && entry == NULL; n++)
+    {
+        ImGuiTextWrapEntry* candidate = &Entries[n];
+        if (candidate->TextPtr != text)
+            continue;
+        if (candidate->Font == font && candidate->FontSize == font_size && candidate->WrapWidth == wrap_width)
+            entry = candidate;
+        else if (unused_entry == NULL && candidate->LastUsedFrame != g.FrameCount)
+            unused_entry = candidate;
+    }
+    if (entry == NULL)
+        entry = unused_entry;
+    if (entry == NULL)
+    {
+        Entries.resize(Entries.Size + 1);
+        entry = &Entries.back();
+        memset(entry, 0, sizeof(*entry));
+        entry->TextPtr = text;
+    }
+    entry->LastUsedFrame = g.FrameCount;
+    if (entry->Text.Size == text_len && entry->Font == font && entry->FontSize == font_size && entry->WrapWidth == wrap_width && memcmp(entry->Text.Data, text, (size_t)text_len) == 0)
+        return entry;
+
+    // Lay out the text again
+    entry->Text.resize(text_len);
+    memcpy(entry->Text.Data, text, (size_t)text_len);
+    entry->Font = font;
+    entry->FontSize = font_size;
+    entry->WrapWidth = wrap_width;
+    entry->Size = ImFontCalcTextLineStarts(font, font_size, wrap_width, text, text_end, &entry->LineStarts);
+    Layouts++;
+    return entry;
+}
+
+void ImGuiTextWrapCache::NewFrame(bool enabled, const ImFontAtlas* atlas)
+{
+    ImGuiContext& g = *GImGui;
+    LayoutsLastFrame = Layouts;
+    Layouts = 0;
+    if (!enabled || FontAtlasBuildCount != atlas->BuildCount)
+        Clear();
+    FontAtlasBuildCount = atlas->BuildCount;
+    for (int n = Entries.Size - 1; n >= 0; n--)
+        if (g.FrameCount - Entries[n].LastUsedFrame > IM_TEXT_WRAP_CACHE_KEEP_FRAMES)
+        {
+            Entries[n].Text.clear();
+            Entries[n].LineStarts.clear();
+            Entries.erase(Entries.Data + n);
+        }
+}
+
+void ImGuiTextWrapCache::Clear()
+{
+    for (int n = 0; n < Entries.Size; n++)
+    {
+        Entries[n].Text.clear();
+        Entries[n].LineStarts.clear();
+    }
+    Entries.clear();
+}
+
+ImGuiMemTag ImGui::GetMemTag()
+{
+    return GImMemTag;
+}
+
+void ImGui::SetMemTag(ImGuiMemTag tag)
+{
+    GImMemTag = tag;
+}
+
+// Header in front of each block allocated through the tracker. Kept at 16 bytes to preserve malloc() alignment.
+struct ImGuiAllocTrackerHeader
+{
+    size_t      Size;
+    ImU32       Tag;
+    ImU32       Magic;
+    ImU32       _Padding[sizeof(size_t) == 4 ? 2 : 0];
+};
+IM_STATIC_ASSERT(sizeof(ImGuiAllocTrackerHeader) == 16);
+static const ImU32 ALLOC_TRACKER_MAGIC = 0xA110C8ED;
+
+static inline void AllocTrackerAddAlloc(ImGuiMemTagStats* stats, size_t size)
+{
+    ImAtomicAdd(&stats->ActiveCount, 1);
+    ImAtomicMax(&stats->HighWaterBytes, ImAtomicAdd(&stats->ActiveBytes, size));
+    ImAtomicAdd(&stats->FrameAllocCount, 1);
+    ImAtomicAdd(&stats->FrameAllocBytes, size);
+}
+
+static inline void AllocTrackerAddFree(ImGuiMemTagStats* stats, size_t size)
+{
+    ImAtomicAdd(&stats->ActiveCount, -1);
+    ImAtomicAdd(&stats->ActiveBytes, (size_t)0 - size);
+    ImAtomicAdd(&stats->FrameFreeCount, 1);
+}
+
+static void* AllocTrackerAlloc(size_t size, void* user_data)
+{
+    ImGuiAllocTracker* tracker = (ImGuiAllocTracker*)user_data;
+    ImGuiAllocTrackerHeader* hdr = (ImGuiAllocTrackerHeader*)tracker->ChainAllocFunc(sizeof(ImGuiAllocTrackerHeader) + size, tracker->ChainUserData);
+    if (hdr == NULL)
+        return NULL;
+    const ImGuiMemTag tag = ImGui::GetMemTag();
+    hdr->Size = size;
+    hdr->Tag = (ImU32)tag;
+    hdr->Magic = ALLOC_TRACKER_MAGIC;
+    AllocTrackerAddAlloc(&tracker->Tags[tag], size);
+    AllocTrackerAddAlloc(&tracker->Total, size);
+    return hdr + 1;
+}
+
+static void AllocTrackerFree(void* ptr, void* user_data)
+{
+    if (ptr == NULL)
+        return;
+    ImGuiAllocTracker* tracker = (ImGuiAllocTracker*)user_data;
+    ImGuiAllocTrackerHeader* hdr = (ImGuiAllocTrackerHeader*)ptr - 1;
+    IM_ASSERT(hdr->Magic == ALLOC_TRACKER_MAGIC && hdr->Tag < ImGuiMemTag_COUNT && "Freeing a block which wasn't allocated through the tracker. Install it before CreateContext()!");
+    hdr->Magic = 0;
+    AllocTrackerAddFree(&tracker->Tags[hdr->Tag], hdr->Size);
+    AllocTrackerAddFree(&tracker->Total, hdr->Size);
+    tracker->ChainFreeFunc(hdr, tracker->ChainUserData);
+}
+
+void ImGuiAllocTracker::NewFrame()
+{
+    for (int n = 0; n <= ImGuiMemTag_COUNT; n++)
+    {
+        ImGuiMemTagStats* stats = (n < ImGuiMemTag_COUNT) ? &Tags[n] : &Total;
+        stats->LastFrameAllocCount = ImAtomicExchange(&stats->FrameAllocCount, 0);
+        stats->LastFrameFreeCount = ImAtomicExchange(&stats->FrameFreeCount, 0);
+        stats->LastFrameAllocBytes = ImAtomicExchange(&stats->FrameAllocBytes, (size_t)0);
+    }
+}
+
+void ImGui::InstallAllocTracker(ImGuiAllocTracker* tracker)
+{
+    IM_ASSERT(GImGui == NULL && "Install the allocation tracker before creating any context!");
+    IM_ASSERT(GImAllocatorAllocFunc != AllocTrackerAlloc);
+    tracker->ChainAllocFunc = GImAllocatorAllocFunc;
+    tracker->ChainFreeFunc = GImAllocatorFreeFunc;
+    tracker->ChainUserData = GImAllocatorUserData;
+    SetAllocatorFunctions(AllocTrackerAlloc, AllocTrackerFree, tracker);
+}
+
+ImGuiAllocTracker* ImGui::GetAllocTracker()
+{
+    return (GImAllocatorAllocFunc == AllocTrackerAlloc) ? (ImGuiAllocTracker*)GImAllocatorUserData : NULL;
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -3972,6 +4859,18 @@ void ImGui::NewFrame()
     g.Time += g.IO.DeltaTime;
     g.WithinFrameScope = true;
     g.FrameCount += 1;
+    g.MemAllocCountLastFrame = ImAtomicExchange(&g.MemAllocCount, 0);
+    g.MemFreeCountLastFrame = ImAtomicExchange(&g.MemFreeCount, 0);
+    if (ImGuiAllocTracker* tracker = GetAllocTracker())
+        tracker->NewFrame();
+    if (g.GcCompactAll)
+        g.FrameArena.Clear();
+    else
+        g.FrameArena.Reset();
+    if (g.IO.Fonts->DynamicData)
+        ImFontAtlasUpdateDynamicGlyphs(g.IO.Fonts); // May change texture coordinates (ImFontAtlas::BuildCount): before the text layout cache
+    g.TextLayoutCache.NewFrame(g.IO.ConfigTextLayoutCache && !g.GcCompactAll, g.IO.Fonts);
+    g.TextWrapCache.NewFrame(g.IO.ConfigTextLayoutCache && !g.GcCompactAll, g.IO.Fonts);
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
@@ -3998,7 +4897,7 @@ void ImGui::NewFrame()
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLines;
-    if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines))
+    if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SDF))) // Baked lines are anti-aliased by their texture alpha, which renderers threshold with ImFontAtlasFlags_SDF
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
@@ -4245,6 +5144,9 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.CurrentTabBarStack.clear();
     g.ShrinkWidthBuffer.clear();
 
+    for (int n = 0; n < g.Tables.GetMapSize(); n++)
+        if (ImGuiTable* table = g.Tables.TryGetMapData(n))
+            TableDataSourceSortCancel(table);
     g.Tables.Clear();
     g.TablesTempData.clear_destruct();
     g.DrawChannelsTempMergeBuffer.clear();
@@ -4252,6 +5154,9 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
     g.InputTextState.ClearFreeMemory();
+    g.FrameArena.Clear();
+    g.TextLayoutCache.Clear();
+    g.TextWrapCache.Clear();
 
     g.SettingsWindows.clear();
     g.SettingsHandlers.clear();
@@ -4339,7 +5244,9 @@ static void AddWindowToDrawData(ImGuiWindow* window, int layer)
     ImGuiContext& g = *GImGui;
     ImGuiViewportP* viewport = g.Viewports[0];
     g.IO.MetricsRenderWindows++;
-    AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[layer], window->DrawList);
+    AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[layer], window->DrawListCacheUsed ? &window->DrawListCache : window->DrawList);
+    for (int i = 0; i < window->DC.SubmittedDrawLists.Size; i++)
+        AddDrawListToDrawData(&viewport->DrawDataBuilder.Layers[layer], window->DC.SubmittedDrawLists[i]);
     for (int i = 0; i < window->DC.ChildWindows.Size; i++)
     {
         ImGuiWindow* child = window->DC.ChildWindows[i];
@@ -4574,7 +5481,33 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+
+    ImGuiTextLayoutEntry* layout = NULL;
+    if (g.IO.ConfigTextLayoutCache)
+    {
+        if (text_display_end == NULL)
+            text_display_end = text + strlen(text);
+        const int text_len = (int)(text_display_end - text);
+        if (text_len >= IM_TEXT_LAYOUT_CACHE_MIN_LEN && text_len <= IM_TEXT_LAYOUT_CACHE_MAX_LEN)
+            layout = g.TextLayoutCache.GetEntry(font, font_size, wrap_width, text, text_display_end);
+    }
+
+    ImVec2 text_size;
+    if (layout && layout->HasSize)
+    {
+        g.TextLayoutCache.Stats.SizeHits++;
+        text_size = layout->Size;
+    }
+    else
+    {
+        text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+        if (layout)
+        {
+            g.TextLayoutCache.Stats.SizeMisses++;
+            layout->Size = text_size;
+            layout->HasSize = true;
+        }
+    }
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -5167,6 +6100,8 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
     //IMGUI_DEBUG_LOG("CreateNewWindow '%s', flags = 0x%08X\n", name, flags);
 
     // Create window the first time
+    ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+    ImGui::SetMemTag(ImGuiMemTag_Window);
     ImGuiWindow* window = IM_NEW(ImGuiWindow)(&g, name);
     window->Flags = flags;
     g.WindowsById.SetVoidPtr(window->ID, window);
@@ -5210,6 +6145,7 @@ static ImGuiWindow* CreateNewWindow(const char* name, ImGuiWindowFlags flags)
         g.Windows.push_front(window); // Quite slow but rare and only once
     else
         g.Windows.push_back(window);
+    ImGui::SetMemTag(backup_mem_tag);
     return window;
 }
 
@@ -5741,6 +6677,76 @@ void ImGui::RenderWindowTitleBarContents(ImGuiWindow* window, const ImRect& titl
     RenderTextClipped(layout_r.Min, layout_r.Max, name, NULL, &text_size, style.WindowTitleAlign, &clip_r);
 }
 
+// Store the state affecting the output of a window using ImGuiWindowFlags_CacheDrawList, return true when it didn't change since
+// the output was recorded so the contents and decorations can be skipped. The key is compared in full: no hash collisions.
+// The contents are assumed to only depend on this state, so interacting with the window (hovering it, active item, keyboard/gamepad navigation) disables reuse.
+static bool ImGui::UpdateWindowDrawListCacheKey(ImGuiWindow* window, const char* name, bool title_bar_is_highlight, const ImU32 resize_grip_col[4], bool decorations_in_parent)
+{
+    ImGuiContext& g = *GImGui;
+    bool valid = true;
+    if (!(window->Flags & ImGuiWindowFlags_CacheDrawList) || window->Appearing || window->Collapsed || g.LogEnabled || decorations_in_parent)
+        valid = false;
+    else if (window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesCanSkipItems > 0 || window->HiddenFramesCannotSkipItems > 0 || window->HiddenFramesForRenderOnly > 0)
+        valid = false;
+    else if (g.HoveredWindow == window || g.MovingWindow == window || (g.ActiveId != 0 && g.ActiveIdWindow == window))
+        valid = false;
+    else if ((g.NavWindow == window && g.IO.NavActive) || g.NavWindowingTarget != NULL || g.NavWindowingTargetAnim != NULL)
+        valid = false;
+    if (!valid)
+    {
+        window->DrawListCacheValid = false;
+        return false;
+    }
+
+    if (memcmp(&g.DrawListCacheStyle, &g.Style, sizeof(ImGuiStyle)) != 0)
+    {
+        memcpy(&g.DrawListCacheStyle, &g.Style, sizeof(ImGuiStyle));
+        g.DrawListCacheStyleVersion++;
+    }
+    ImGuiWindowDrawListCacheKey key;
+    key.Pos = window->Pos;
+    key.Size = window->Size;
+    key.Scroll = window->Scroll;
+    key.InnerClipRect = window->InnerClipRect;
+    key.DisplaySize = g.IO.DisplaySize;
+    key.FontSize = g.FontSize;
+    key.DimBgRatio = (window->Flags & ImGuiWindowFlags_Modal) ? g.DimBgRatio : 0.0f;
+    key.BgAlpha = (g.NextWindowData.Flags & ImGuiNextWindowDataFlags_HasBgAlpha) ? g.NextWindowData.BgAlphaVal : -1.0f;
+    memcpy(key.ResizeGripCol, resize_grip_col, sizeof(key.ResizeGripCol));
+    key.Flags = window->Flags;
+    key.StyleVersion = g.DrawListCacheStyleVersion;
+    key.FontAtlasBuildCount = g.IO.Fonts->BuildCount;
+    key.Font = g.Font;
+    key.TitleBarIsHighlight = title_bar_is_highlight;
+    key.HasCloseButton = window->HasCloseButton;
+    key.ResizeBorderHeld = window->ResizeBorderHeld;
+
+    const int title_len = (int)strlen(name) + 1;
+    bool unchanged = window->DrawListCacheValid && !(g.NextWindowData.Flags & ImGuiNextWindowDataFlags_Dirty);
+    unchanged = unchanged && memcmp(&key, &window->DrawListCacheKey, sizeof(key)) == 0;
+    unchanged = unchanged && window->DrawListCacheTitle.Size == title_len && memcmp(window->DrawListCacheTitle.Data, name, (size_t)title_len) == 0;
+    if (!unchanged)
+    {
+        window->DrawListCacheKey = key;
+        window->DrawListCacheTitle.resize(title_len);
+        memcpy(window->DrawListCacheTitle.Data, name, (size_t)title_len);
+    }
+    window->DrawListCacheValid = true;
+    return unchanged;
+}
+
+// Exchange the output of two draw lists without copying it
+static void ImGui::SwapDrawListBuffers(ImDrawList* a, ImDrawList* b)
+{
+    a->CmdBuffer.swap(b->CmdBuffer);
+    a->IdxBuffer.swap(b->IdxBuffer);
+    a->VtxBuffer.swap(b->VtxBuffer);
+    ImSwap(a->Flags, b->Flags);
+    ImSwap(a->_VtxCurrentIdx, b->_VtxCurrentIdx);
+    ImSwap(a->_VtxWritePtr, b->_VtxWritePtr);
+    ImSwap(a->_IdxWritePtr, b->_IdxWritePtr);
+}
+
 void ImGui::UpdateWindowParentAndRootLinks(ImGuiWindow* window, ImGuiWindowFlags flags, ImGuiWindow* parent_window)
 {
     window->ParentWindow = parent_window;
@@ -5898,6 +6904,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         SetWindowConditionAllowFlags(window, ImGuiCond_Appearing, false);
 
     // When reusing window again multiple times a frame, just append content (don't need to setup again)
+    bool draw_list_cache_hit = false;
     if (first_begin_of_the_frame)
     {
         // Initialize
@@ -5906,6 +6913,11 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->HasCloseButton = (p_open != NULL);
         window->ClipRect = ImVec4(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
         window->IDStack.resize(1);
+
+        // Set aside the output of last frame when it may be reused (ImGuiWindowFlags_CacheDrawList), DrawList is rebuilt from scratch either way.
+        if (window->DrawListCacheValid && !window->DrawListCacheUsed)
+            SwapDrawListBuffers(window->DrawList, &window->DrawListCache);
+        window->DrawListCacheUsed = false;
         window->DrawList->_ResetForNewFrame();
         window->DC.CurrentTableIdx = -1;
 
@@ -6234,9 +7246,12 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
                 window->DrawList = parent_window->DrawList;
 
             // Handle title bar, scrollbar, resize grips and resize borders
+            // They are skipped along with the contents when the output of a previous frame is reused (ImGuiWindowFlags_CacheDrawList)
             const ImGuiWindow* window_to_highlight = g.NavWindowingTarget ? g.NavWindowingTarget : g.NavWindow;
             const bool title_bar_is_highlight = want_focus || (window_to_highlight && window->RootWindowForTitleBarHighlight == window_to_highlight->RootWindowForTitleBarHighlight);
-            RenderWindowDecorations(window, title_bar_rect, title_bar_is_highlight, resize_grip_count, resize_grip_col, resize_grip_draw_size);
+            draw_list_cache_hit = UpdateWindowDrawListCacheKey(window, name, title_bar_is_highlight, resize_grip_col, render_decorations_in_parent);
+            if (!draw_list_cache_hit)
+                RenderWindowDecorations(window, title_bar_rect, title_bar_is_highlight, resize_grip_count, resize_grip_col, resize_grip_draw_size);
 
             if (render_decorations_in_parent)
                 window->DrawList = &window->DrawListInst;
@@ -6306,6 +7321,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->DC.TreeDepth = 0;
         window->DC.TreeJumpToParentOnPopMask = 0x00;
         window->DC.ChildWindows.resize(0);
+        window->DC.SubmittedDrawLists.resize(0);
         window->DC.StateStorage = &window->StateStorage;
         window->DC.CurrentColumns = NULL;
         window->DC.LayoutType = ImGuiLayoutType_Vertical;
@@ -6330,7 +7346,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         }
 
         // Title bar
-        if (!(flags & ImGuiWindowFlags_NoTitleBar))
+        if (!(flags & ImGuiWindowFlags_NoTitleBar) && !draw_list_cache_hit)
             RenderWindowTitleBarContents(window, ImRect(title_bar_rect.Min.x + window->WindowBorderSize, title_bar_rect.Min.y, title_bar_rect.Max.x - window->WindowBorderSize, title_bar_rect.Max.y), name, p_open);
 
         // Clear hit test shape every frame
@@ -6414,6 +7430,18 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
             if (window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesCannotSkipItems <= 0)
                 skip_items = true;
         window->SkipItems = skip_items;
+
+        // Skip the contents and render the output of the last frame which submitted them if nothing affecting it changed (ImGuiWindowFlags_CacheDrawList)
+        if (draw_list_cache_hit && !skip_items)
+        {
+            window->DrawListCacheUsed = true;
+            window->SkipItems = true;
+            window->DC.CursorMaxPos = window->DrawListCacheCursorMaxPos;
+            window->DC.IdealMaxPos = window->DrawListCacheIdealMaxPos;
+            window->DC.NavLayersActiveMaskNext |= window->DrawListCacheNavLayersActiveMask;
+        }
+        if (skip_items)
+            window->DrawListCacheValid = false;
     }
 
     return !window->SkipItems;
@@ -6445,6 +7473,17 @@ void ImGui::End()
     if (!(window->Flags & ImGuiWindowFlags_ChildWindow))    // FIXME: add more options for scope of logging
         LogFinish();
 
+    // Save the layout of submitted contents, for the frames reusing their output (ImGuiWindowFlags_CacheDrawList)
+    // Windows which began other windows (child windows, popups) or became active can't be reused.
+    if (window->DrawListCacheValid && !window->DrawListCacheUsed)
+    {
+        if (g.WindowsActiveCount != window->BeginOrderWithinContext + 1 || window->DC.SubmittedDrawLists.Size > 0 || (g.ActiveId != 0 && g.ActiveIdWindow == window))
+            window->DrawListCacheValid = false;
+        window->DrawListCacheCursorMaxPos = window->DC.CursorMaxPos;
+        window->DrawListCacheIdealMaxPos = window->DC.IdealMaxPos;
+        window->DrawListCacheNavLayersActiveMask = window->DC.NavLayersActiveMaskNext;
+    }
+
     // Pop from window stack
     g.LastItemData = g.CurrentWindowStack.back().ParentLastItemDataBackup;
     if (window->Flags & ImGuiWindowFlags_Popup)
@@ -7030,12 +8069,46 @@ void ImGui::SetNextWindowBgAlpha(float alpha)
     g.NextWindowData.BgAlphaVal = alpha;
 }
 
+void ImGui::SetNextWindowDirty()
+{
+    ImGuiContext& g = *GImGui;
+    g.NextWindowData.Flags |= ImGuiNextWindowDataFlags_Dirty;
+}
+
 ImDrawList* ImGui::GetWindowDrawList()
 {
     ImGuiWindow* window = GetCurrentWindow();
     return window->DrawList;
 }
 
+// Setup a user-owned draw list so it can be recorded outside of the main thread, then passed to SubmitDrawList().
+// The shared data is copied so the recording thread never reads from the context (which may be modified concurrently by the main thread).
+// The list starts with the clipping rectangle and texture currently used by the window, so it behaves like GetWindowDrawList() at the time of the call.
+// Note that growing the list on another thread goes through MemAlloc()/MemFree(), so your allocator functions must be thread-safe (the default ones are),
+// and io.MetricsActiveAllocations may be slightly off as it is not updated atomically.
+void ImGui::PrepareDrawList(ImDrawList* draw_list, ImDrawListSharedData* shared_data)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    IM_ASSERT(draw_list != NULL && shared_data != NULL);
+    IM_ASSERT(draw_list != window->DrawList && "Use a separate ImDrawList instance!");
+    *shared_data = g.DrawListSharedData;
+    draw_list->_Data = shared_data;
+    draw_list->_OwnerName = window->Name;
+    draw_list->_ResetForNewFrame();
+    draw_list->PushTextureID(window->DrawList->_CmdHeader.TextureId);
+    draw_list->PushClipRect(window->DrawList->GetClipRectMin(), window->DrawList->GetClipRectMax(), false);
+}
+
+// Lists are kept by pointer until Render(): the caller must have finished recording (e.g. joined its worker threads) before calling this, and must keep 'draw_list' alive until the draw data has been rendered.
+void ImGui::SubmitDrawList(ImDrawList* draw_list)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    IM_ASSERT(draw_list != NULL && draw_list != window->DrawList);
+    IM_ASSERT(draw_list->_ClipRectStack.Size == 1 && draw_list->_TextureIdStack.Size == 1 && "Mismatched PushClipRect()/PopClipRect() or PushTextureID()/PopTextureID() calls in submitted draw list!");
+    window->DC.SubmittedDrawLists.push_back(draw_list);
+}
+
 ImFont* ImGui::GetFont()
 {
     return GImGui->Font;
@@ -10725,7 +11798,10 @@ ImGuiWindowSettings* ImGui::CreateNewWindowSettings(const char* name)
 
     // Allocate chunk
     const size_t chunk_size = sizeof(ImGuiWindowSettings) + name_len + 1;
+    ImGuiMemTag backup_mem_tag = GetMemTag();
+    SetMemTag(ImGuiMemTag_Settings);
     ImGuiWindowSettings* settings = g.SettingsWindows.alloc_chunk(chunk_size);
+    SetMemTag(backup_mem_tag);
     IM_PLACEMENT_NEW(settings) ImGuiWindowSettings();
     settings->ID = ImHashStr(name, name_len);
     memcpy(settings->GetName(), name, name_len + 1);   // Store with zero terminator
@@ -10790,6 +11866,8 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
     // For our convenience and to make the code simpler, we'll also write zero-terminators within the buffer. So let's create a writable copy..
     if (ini_size == 0)
         ini_size = strlen(ini_data);
+    ImGuiMemTag backup_mem_tag = GetMemTag();
+    SetMemTag(ImGuiMemTag_Settings);
     g.SettingsIniData.Buf.resize((int)ini_size + 1);
     char* const buf = g.SettingsIniData.Buf.Data;
     char* const buf_end = buf + ini_size;
@@ -10847,6 +11925,7 @@ void ImGui::LoadIniSettingsFromMemory(const char* ini_data, size_t ini_size)
     for (int handler_n = 0; handler_n < g.SettingsHandlers.Size; handler_n++)
         if (g.SettingsHandlers[handler_n].ApplyAllFn)
             g.SettingsHandlers[handler_n].ApplyAllFn(&g, &g.SettingsHandlers[handler_n]);
+    SetMemTag(backup_mem_tag);
 }
 
 void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
@@ -10869,6 +11948,8 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
 const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
 {
     ImGuiContext& g = *GImGui;
+    ImGuiMemTag backup_mem_tag = GetMemTag();
+    SetMemTag(ImGuiMemTag_Settings);
     g.SettingsDirtyTimer = 0.0f;
     g.SettingsIniData.Buf.resize(0);
     g.SettingsIniData.Buf.push_back(0);
@@ -10877,6 +11958,7 @@ const char* ImGui::SaveIniSettingsToMemory(size_t* out_size)
         ImGuiSettingsHandler* handler = &g.SettingsHandlers[handler_n];
         handler->WriteAllFn(&g, handler, &g.SettingsIniData);
     }
+    SetMemTag(backup_mem_tag);
     if (out_size)
         *out_size = (size_t)g.SettingsIniData.size();
     return g.SettingsIniData.c_str();
@@ -11275,6 +12357,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     Text("%d visible windows, %d active allocations", io.MetricsRenderWindows, io.MetricsActiveAllocations);
+    Text("%d allocations, %d frees last frame. Frame arena: %d/%d bytes used (peak %d)", g.MemAllocCountLastFrame, g.MemFreeCountLastFrame, g.FrameArena.LastFrameUsed, g.FrameArena.BlockSize, g.FrameArena.HighWater);
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -11536,6 +12619,72 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         TreePop();
     }
 
+    // Memory
+    if (TreeNode("Memory"))
+    {
+        Text("MemAlloc: %d calls, MemFree: %d calls last frame", g.MemAllocCountLastFrame, g.MemFreeCountLastFrame);
+        Text("Frame arena: %d blocks, %d bytes, used %d last frame, high-water %d", g.FrameArena.Blocks.Size, g.FrameArena.BlockSize, g.FrameArena.LastFrameUsed, g.FrameArena.HighWater);
+        ImGuiAllocTracker* tracker = GetAllocTracker();
+        if (tracker == NULL)
+        {
+            TextDisabled("No allocation tracker installed, see InstallAllocTracker().");
+        }
+        else if (BeginTable("##memtags", 7, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+        {
+            const char* mem_tag_names[] = { "Misc", "DrawList", "Font", "Table", "TextBuffer", "Settings", "Window" }; IM_ASSERT(IM_ARRAYSIZE(mem_tag_names) == ImGuiMemTag_COUNT);
+            TableSetupColumn("Tag");
+            TableSetupColumn("Live blocks");
+            TableSetupColumn("Live bytes");
+            TableSetupColumn("High-water");
+            TableSetupColumn("Allocs/frame");
+            TableSetupColumn("Frees/frame");
+            TableSetupColumn("Bytes/frame");
+            TableHeadersRow();
+            for (int tag_n = 0; tag_n <= ImGuiMemTag_COUNT; tag_n++)
+            {
+                const ImGuiMemTagStats* stats = (tag_n < ImGuiMemTag_COUNT) ? &tracker->Tags[tag_n] : &tracker->Total;
+                TableNextRow();
+                TableNextColumn(); TextUnformatted((tag_n < ImGuiMemTag_COUNT) ? mem_tag_names[tag_n] : "Total");
+                TableNextColumn(); Text("%d", ImAtomicLoad(&stats->ActiveCount));
+                TableNextColumn(); Text("%d", (int)ImAtomicLoad(&stats->ActiveBytes));
+                TableNextColumn(); Text("%d", (int)ImAtomicLoad(&stats->HighWaterBytes));
+                TableNextColumn(); Text("%d", stats->LastFrameAllocCount);
+                TableNextColumn(); Text("%d", stats->LastFrameFreeCount);
+                TableNextColumn(); Text("%d", (int)stats->LastFrameAllocBytes);
+            }
+            EndTable();
+        }
+        TreePop();
+    }
+
+    // Text layout cache
+    if (TreeNode("Text layout cache"))
+    {
+        ImGuiTextLayoutCache& cache = g.TextLayoutCache;
+        const ImGuiTextLayoutCacheStats& stats = cache.StatsLastFrame;
+        Checkbox("io.ConfigTextLayoutCache", &g.IO.ConfigTextLayoutCache);
+        int entries_used = 0, quads_count = 0;
+        for (int n = 0; n < cache.Entries.Size; n++)
+            if (cache.Entries[n].Key != 0)
+            {
+                entries_used++;
+                quads_count += cache.Entries[n].Quads.Size / 4;
+            }
+        Text("Entries: %d/%d, %d glyph quads", entries_used, cache.Entries.Size, quads_count);
+        Text("Last frame: size %d hits, %d misses (%.1f%%)", stats.SizeHits, stats.SizeMisses, stats.SizeHits + stats.SizeMisses > 0 ? stats.SizeHits * 100.0f / (stats.SizeHits + stats.SizeMisses) : 0.0f);
+        Text("Last frame: quads %d hits, %d misses (%.1f%%)", stats.QuadsHits, stats.QuadsMisses, stats.QuadsHits + stats.QuadsMisses > 0 ? stats.QuadsHits * 100.0f / (stats.QuadsHits + stats.QuadsMisses) : 0.0f);
+        Text("Last frame: %d evictions", stats.Evictions);
+        int wrap_lines_count = 0, wrap_text_size = 0;
+        for (int n = 0; n < g.TextWrapCache.Entries.Size; n++)
+        {
+            wrap_lines_count += g.TextWrapCache.Entries[n].LineStarts.Size;
+            wrap_text_size += g.TextWrapCache.Entries[n].Text.Size;
+        }
+        Text("Long wrapped text: %d entries, %d lines, %d bytes", g.TextWrapCache.Entries.Size, wrap_lines_count, wrap_text_size);
+        Text("Last frame: %d wrapped text layouts", g.TextWrapCache.LayoutsLastFrame);
+        TreePop();
+    }
+
     // Misc Details
     if (TreeNode("Internal state"))
     {
@@ -11845,9 +12994,10 @@ void ImGui::DebugNodeFont(ImFont* font)
                 continue;
             }
 
+            // Test IndexLookup[] to count glyphs pending rasterization too (ImFontAtlasFlags_DynamicGlyphs), they are rasterized when the node is opened
             int count = 0;
             for (unsigned int n = 0; n < 256; n++)
-                if (font->FindGlyphNoFallback((ImWchar)(base + n)))
+                if (base + n < (unsigned int)font->IndexLookup.Size && font->IndexLookup.Data[base + n] != (ImWchar)-1)
                     count++;
             if (count <= 0)
                 continue;
@@ -11862,7 +13012,7 @@ void ImGui::DebugNodeFont(ImFont* font)
                 // available here and thus cannot easily generate a zero-terminated UTF-8 encoded string.
                 ImVec2 cell_p1(base_pos.x + (n % 16) * (cell_size + cell_spacing), base_pos.y + (n / 16) * (cell_size + cell_spacing));
                 ImVec2 cell_p2(cell_p1.x + cell_size, cell_p1.y + cell_size);
-                const ImFontGlyph* glyph = font->FindGlyphNoFallback((ImWchar)(base + n));
+                const ImFontGlyph* glyph = font->LoadGlyphNoFallback((ImWchar)(base + n));
                 draw_list->AddRect(cell_p1, cell_p2, glyph ? IM_COL32(255, 255, 255, 100) : IM_COL32(255, 255, 255, 50));
                 if (glyph)
                     font->RenderChar(draw_list, cell_size, cell_p1, glyph_col, (ImWchar)(base + n));
@@ -11986,6 +13136,8 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
 
     ImGuiWindowFlags flags = window->Flags;
     DebugNodeDrawList(window, window->DrawList, "DrawList");
+    if (window->DrawListCacheUsed)
+        DebugNodeDrawList(window, &window->DrawListCache, "DrawListCache");
     BulletText("Pos: (%.1f,%.1f), Size: (%.1f,%.1f), ContentSize (%.1f,%.1f) Ideal (%.1f,%.1f)", window->Pos.x, window->Pos.y, window->Size.x, window->Size.y, window->ContentSize.x, window->ContentSize.y, window->ContentSizeIdeal.x, window->ContentSizeIdeal.y);
     BulletText("Flags: 0x%08X (%s%s%s%s%s%s%s%s%s..)", flags,
         (flags & ImGuiWindowFlags_ChildWindow)  ? "Child " : "",      (flags & ImGuiWindowFlags_Tooltip)     ? "Tooltip "   : "",  (flags & ImGuiWindowFlags_Popup) ? "Popup " : "",
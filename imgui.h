@@ -31,7 +31,7 @@ Index of this file:
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiVariableListClipper, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -144,6 +144,7 @@ struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 byte
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
+struct ImFontAtlasDynamicData;      // Opaque builder state for ImFontAtlasFlags_DynamicGlyphs
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
@@ -152,6 +153,7 @@ struct ImGuiContext;                // Dear ImGui context (opaque structure, unl
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiVariableListClipper;    // Helper to manually clip large list of items of variable heights
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame, used by IMGUI_ONCE_UPON_A_FRAME macro
 struct ImGuiPayload;                // User data payload for drag and drop operations
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
@@ -252,6 +254,10 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef void    (*ImGuiJobFunc)(void* job_data, int job_index);                  // Job function for io.ParallelForFn and ImFontAtlas::BuildParallelFor
+typedef void    (*ImGuiParallelForFunc)(ImGuiJobFunc job_func, void* job_data, int job_count, void* user_data); // Function signature for io.ParallelForFn and ImFontAtlas::BuildParallelFor
+typedef const char* (*ImGuiTableCellGetter)(void* user_data, int row_n, int column_n, char* buf, int buf_size); // Callback function for ImGui::TableDataSourceRows()
+typedef int     (*ImGuiTableRowsCompare)(void* user_data, int row_a, int row_b, int column_n); // Function signature for ImGui::TableDataSourceRows()
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -354,6 +360,8 @@ namespace ImGui
     IMGUI_API bool          IsWindowFocused(ImGuiFocusedFlags flags=0); // is current window focused? or its root/child, depending on flags. see flags for options.
     IMGUI_API bool          IsWindowHovered(ImGuiHoveredFlags flags=0); // is current window hovered (and typically: not blocked by a popup/modal)? see flags for options. NB: If you are trying to check whether your mouse should be dispatched to imgui or to your app, you should use the 'io.WantCaptureMouse' boolean for that! Please read the FAQ!
     IMGUI_API ImDrawList*   GetWindowDrawList();                        // get draw list associated to the current window, to append your own drawing primitives
+    IMGUI_API void          PrepareDrawList(ImDrawList* draw_list, ImDrawListSharedData* shared_data); // reset your own draw list and setup it with a private copy of the shared data + current window clip rect/texture, so it can be recorded from another thread. call from the main thread.
+    IMGUI_API void          SubmitDrawList(ImDrawList* draw_list);      // append your own draw list (recorded after PrepareDrawList()) to the current window, rendered after the window contents in submission order. call from the main thread once recording is finished. keep it alive until rendered.
     IMGUI_API ImVec2        GetWindowPos();                             // get current window position in screen space (useful if you want to do your own drawing via the DrawList API)
     IMGUI_API ImVec2        GetWindowSize();                            // get current window size
     IMGUI_API float         GetWindowWidth();                           // get current window width (shortcut for GetWindowSize().x)
@@ -368,6 +376,7 @@ namespace ImGui
     IMGUI_API void          SetNextWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                 // set next window collapsed state. call before Begin()
     IMGUI_API void          SetNextWindowFocus();                                                       // set next window to be focused / top-most. call before Begin()
     IMGUI_API void          SetNextWindowBgAlpha(float alpha);                                          // set next window background color alpha. helper to easily override the Alpha component of ImGuiCol_WindowBg/ChildBg/PopupBg. you may also use ImGuiWindowFlags_NoBackground.
+    IMGUI_API void          SetNextWindowDirty();                                                       // set next window contents as changed, for windows using ImGuiWindowFlags_CacheDrawList. call before Begin()
     IMGUI_API void          SetWindowPos(const ImVec2& pos, ImGuiCond cond = 0);                        // (not recommended) set current window position - call within Begin()/End(). prefer using SetNextWindowPos(), as this may incur tearing and side-effects.
     IMGUI_API void          SetWindowSize(const ImVec2& size, ImGuiCond cond = 0);                      // (not recommended) set current window size - call within Begin()/End(). set to ImVec2(0, 0) to force an auto-fit. prefer using SetNextWindowSize(), as this may incur tearing and minor side-effects.
     IMGUI_API void          SetWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                     // (not recommended) set current window collapsed state. prefer using SetNextWindowCollapsed().
@@ -762,6 +771,26 @@ namespace ImGui
     // - Lifetime: don't hold on this pointer over multiple frames or past any subsequent call to BeginTable().
     IMGUI_API ImGuiTableSortSpecs*  TableGetSortSpecs();                        // get latest sort specs for the table (NULL if not sorting).
 
+    // Tables: Data source
+    // - Instead of submitting every row, let the table pull the text of visible cells from your data with TableDataSourceRows().
+    //   Call it after TableSetupColumn()/TableHeadersRow(), in place of the TableNextRow() calls and the ImGuiListClipper loop.
+    // - Rows are clipped (cost is proportional to visible rows and columns, whatever 'rows_count' is, e.g. 10M rows).
+    // - With ImGuiTableFlags_Sortable, rows are displayed in the order of the sort specs. The order is computed once and cached by
+    //   the table: it is only computed again when the sort specs change or after TableSetDataSourceDirty(). When 'rows_count' grows,
+    //   rows are assumed to be appended: only the new rows are sorted and merged into the cached order (call TableSetDataSourceDirty()
+    //   if existing rows changed too). The sort is stable, and runs on your worker threads if you set io.ParallelForFn.
+    // - With io.BackgroundJobFn, sorting all rows of a large table (10k+ rows) runs in the background instead of stalling the frame:
+    //   the previous order stays displayed until the new one is ready (rows appended meanwhile are displayed last, unsorted).
+    //   Until TableIsDataSourceSorting() returns false, your functions are called from that thread and rows must not change.
+    //   'rows_compare' compares two rows on one column, return <0, 0 or >0 (ascending order). NULL to compare the cell texts with strcmp().
+    // - 'cell_getter' returns the text of a cell: either a pointer to your own storage, or 'buf' after formatting into it.
+    //   Two calls may be alive at the same time (comparing texts), so don't return a pointer to a single static buffer.
+    // - Columns fitting their contents keep the width of the widest cell displayed so far, so widths don't change while scrolling.
+    IMGUI_API void                  TableDataSourceRows(int rows_count, ImGuiTableCellGetter cell_getter, ImGuiTableRowsCompare rows_compare, void* user_data);
+    IMGUI_API void                  TableSetDataSourceDirty();                  // data changed: sort again on the next TableDataSourceRows() call and measure cells again.
+    IMGUI_API const int*            TableSortRows(int rows_count, ImGuiTableRowsCompare rows_compare, void* user_data); // same cached sort, for rows you submit yourself: return the rows indices in display order, NULL if not sorting.
+    IMGUI_API bool                  TableIsDataSourceSorting();                 // return true while rows are sorted in the background (io.BackgroundJobFn): the previous order is displayed.
+
     // Tables: Miscellaneous functions
     // - Functions args 'int column_n' treat the default value of -1 as the same as passing the current column index.
     IMGUI_API int                   TableGetColumnCount();                      // return number of columns (value passed to BeginTable)
@@ -969,6 +998,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 18,  // No gamepad/keyboard navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 19,  // No focusing toward this window with gamepad/keyboard navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 20,  // Display a dot next to the title. When used in a tab/docking context, tab is selected when clicking the X + closure is not assumed (will wait for user to stop submitting the tab). Otherwise closure is assumed when pressing the X, so if you keep submitting the tab may reappear at end of tab bar.
+    ImGuiWindowFlags_CacheDrawList          = 1 << 21,  // Reuse the draw list of the last frame which submitted the window contents while nothing affecting it changed (position, size, scroll, hovering, active item, focus, style, font). Begin() returns false on those frames, so contents must not change otherwise: call SetNextWindowDirty() when they do. For static panels.
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -1852,6 +1882,7 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    bool        ConfigTextLayoutCache;          // = false          // Cache the size and glyph quads of recently used text, for UI with a lot of static text, and the line breaks of long wrapped text. Stats are shown in the Metrics window.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1876,6 +1907,18 @@ struct ImGuiIO
     void        (*ImeSetInputScreenPosFn)(int x, int y);
     void*       ImeWindowHandle;                // = NULL           // (Windows) Set this to your HWND to get automatic IME cursor positioning.
 
+    // Optional: Run jobs on your worker threads (used to sort large tables, see TableDataSourceRows(), and to build the font atlas, see ImFontAtlas::BuildParallelFor)
+    // Call job_func(job_data, n) for every n in [0, job_count), in any order and from any threads, and return once they all returned.
+    // The functions given to TableDataSourceRows()/TableSortRows() are then called from those threads too.
+    ImGuiParallelForFunc ParallelForFn;         // = NULL
+    void*       ParallelForUserData;            // = NULL
+
+    // Optional: Run a job in the background on one of your threads (used to sort large tables without stalling frames, see TableDataSourceRows())
+    // Call job_func(job_data, 0) once from another thread and return immediately: completion is polled on the next frames. The job may call
+    // io.ParallelForFn from that thread. Pending jobs are cancelled and waited for by DestroyContext(), keep your threads alive until then.
+    void        (*BackgroundJobFn)(ImGuiJobFunc job_func, void* job_data, void* user_data); // = NULL
+    void*       BackgroundJobUserData;          // = NULL
+
     //------------------------------------------------------------------
     // Input - Fill before calling NewFrame()
     //------------------------------------------------------------------
@@ -2051,7 +2094,7 @@ struct ImGuiTableSortSpecs
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
+// [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiVariableListClipper, ImColor)
 //-----------------------------------------------------------------------------
 
 // Helper: Unicode defines
@@ -2140,10 +2183,23 @@ struct ImGuiStorage
 
     ImVector<ImGuiStoragePair>      Data;
 
+#ifdef IMGUI_USE_HASHED_STORAGE
+    // [Internal] Open-addressing (Robin Hood) index into Data, rebuilt lazily when Data.Size changes behind our back.
+    struct ImGuiStorageSlot { ImGuiID key; int idx; };
+    ImVector<ImGuiStorageSlot>      Slots;
+    int                             SlotsIndexedCount;
+    ImGuiStorage()      { SlotsIndexedCount = 0; }
+#endif
+
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+    // - With IMGUI_USE_HASHED_STORAGE (see imconfig.h), pairs are stored in insertion order and indexed by a hash table: queries and insertions are O(1).
+#ifdef IMGUI_USE_HASHED_STORAGE
+    void                Clear() { Data.clear(); Slots.clear(); SlotsIndexedCount = 0; }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2166,6 +2222,7 @@ struct ImGuiStorage
     IMGUI_API void      SetAllInt(int val);
 
     // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // (With IMGUI_USE_HASHED_STORAGE this also rebuilds the index: call it after modifying Data directly.)
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -2212,6 +2269,52 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Manually clip large list of items of variable heights (e.g. a log mixing single-line and wrapped multi-line entries).
+// Unlike ImGuiListClipper, this needs to persist across frames: the height of each item is measured when it is displayed,
+// and stored as prefix sums (Fenwick tree) over blocks of 64 items so the first visible item can be found with a binary search.
+// Items never displayed use an estimated height, so the total height and the scrollbar get more accurate as you scroll.
+// A frame costs O(log N + visible items), and memory is ~0.3 bytes per item plus 256 bytes per block with a displayed item,
+// which keeps lists with millions of items usable.
+// Usage:
+//   static ImGuiVariableListClipper clipper;     // Persistent (static or a member of your view)
+//   clipper.Begin(items.Size);                   // Items may be appended or removed between frames, measured heights are kept
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           ImGui::TextWrapped("%s", items[i]);
+// Each Step() hands out a single item (DisplayEnd = DisplayStart + 1) and measures it on the next call.
+// Call ClearHeights() when the heights of existing items change (e.g. different wrap width or font), or after inserting/removing items other than at the end.
+struct ImGuiVariableListClipper
+{
+    int     DisplayStart;
+    int     DisplayEnd;
+
+    // [Internal]
+    int     ItemsCount;
+    int     StepNo;
+    int     ItemsFrozen;
+    float   ItemsHeightEstimate;
+    float   StartPosY;
+    float   ItemStartPosY;
+    float   ClipMaxY;
+    bool    DisplayExtraItem;
+    double  MeasuredHeightsSum;
+    int     MeasuredCount;
+    int     HeightsCount;                   // Number of items heights are kept for (ItemsCount of the last Begin())
+    ImVector<float*>    BlocksHeights;      // Measured height of each item per block of 64 items, -1.0f if never displayed. NULL until an item of the block is displayed.
+    ImVector<double>    TreeHeightsSums;    // Fenwick tree of measured heights, one node per block
+    ImVector<int>       TreeMeasuredCounts; // Fenwick tree of the number of measured items, one node per block
+
+    IMGUI_API ImGuiVariableListClipper();
+    IMGUI_API ~ImGuiVariableListClipper();
+
+    // items_height_estimate: height used for items never displayed. Use -1.0f for the average of the measured heights (GetTextLineHeightWithSpacing() until one is measured).
+    IMGUI_API void  Begin(int items_count, float items_height_estimate = -1.0f);
+    IMGUI_API void  End();                                  // Automatically called on the last call of Step() that returns false.
+    IMGUI_API bool  Step();                                 // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw this item.
+    IMGUI_API float GetItemOffsetY(int item_n);             // Distance from the first item to 'item_n' (estimated if some items in-between were never displayed), e.g. to scroll to an item.
+    IMGUI_API void  ClearHeights();                         // Forget all measured heights.
+};
+
 // Helpers macros to generate 32-bit encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -2447,6 +2550,13 @@ struct ImDrawList
     IMGUI_API void  AddBezierCubic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, const ImVec2& p4, ImU32 col, float thickness, int num_segments = 0); // Cubic Bezier (4 control points)
     IMGUI_API void  AddBezierQuadratic(const ImVec2& p1, const ImVec2& p2, const ImVec2& p3, ImU32 col, float thickness, int num_segments = 0);               // Quadratic Bezier (3 control points)
 
+    // Batched primitives
+    // - Same output as calling AddRectFilled()/AddCircleFilled() for each shape, but vertices/indices are reserved in bulk and written in a tight loop.
+    // - Circles are tessellated once as a template. With num_segments == 0 the template is rebuilt when the automatic segment count changes, so sort by radius if you can.
+    IMGUI_API void  AddRectFilledBatch(const ImVec2* p_min, const ImVec2* sizes, const ImU32* cols, int count);                                   // No rounding. Rect n = p_min[n] -> p_min[n] + sizes[n].
+    IMGUI_API void  AddCircleFilledBatch(const ImVec2* centers, int centers_count, float radius, ImU32 col, int num_segments = 0);                  // Same radius and color for all circles.
+    IMGUI_API void  AddCircleFilledBatch(const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments = 0);         // Per-circle radius and color.
+
     // Image primitives
     // - Read FAQ to understand what ImTextureID is.
     // - "p_min" and "p_max" represent the upper-left and lower-right corners of the rectangle.
@@ -2510,6 +2620,7 @@ struct ImDrawList
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
+    IMGUI_API void  _AddCircleFilledBatch(const ImVec2* centers, const float* radii, float radius, const ImU32* cols, ImU32 col, int count, int num_segments);
 };
 
 // All draw data to render a Dear ImGui frame
@@ -2611,7 +2722,9 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
-    ImFontAtlasFlags_NoBakedLines       = 1 << 2    // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 3,   // Only rasterize ASCII in Build(), other glyphs are rasterized the first time they are used (stb_truetype builder only). For large glyph ranges, e.g. GetGlyphRangesChineseFull(). The backend needs to upload GetTexDataDirtyRect() every frame. Not compatible with recording text from other threads (PrepareDrawList()).
+    ImFontAtlasFlags_SDF                = 1 << 4    // Rasterize glyphs as signed distance fields (stb_truetype builder only), the glyph outline is at alpha 0.5: text stays sharp at any scale (FontGlobalScale, DPI) without rebuilding the atlas, if the renderer thresholds the font texture alpha around 0.5 and keeps the white pixel (1.0) opaque. Anti-aliased lines don't use the baked line textures. See SdfSpread. Ignores ImFontAtlasFlags_DynamicGlyphs, OversampleH/V and RasterizerMultiply.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2656,6 +2769,9 @@ struct ImFontAtlas
     IMGUI_API void              GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 4 bytes-per-pixel
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't built texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
+    IMGUI_API bool              GetTexDataDirtyRect(int* out_x, int* out_y, int* out_w, int* out_h); // ImFontAtlasFlags_DynamicGlyphs: return and clear the rectangle of pixels changed since the last call, e.g. to upload it with glTexSubImage2D(). Upload the whole texture if TexWidth/TexHeight changed.
+    IMGUI_API bool              SaveBuildCacheToMemory(ImVector<unsigned char>* out_data);    // Serialize the output of Build() (Alpha8 pixels, glyphs, custom rectangles positions) with a key made of its inputs (font data, configs, glyph ranges, settings). Return false if not built or with ImFontAtlasFlags_DynamicGlyphs.
+    IMGUI_API bool              LoadBuildCacheFromMemory(const void* data, size_t data_size); // Call instead of Build(), after adding the same fonts and custom rectangles: restore the output of Build() without rasterizing. Return false if the data doesn't match the current inputs, then call Build().
 
     //-------------------------------------------
     // Glyph Ranges
@@ -2701,6 +2817,9 @@ struct ImFontAtlas
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
+    ImGuiParallelForFunc        BuildParallelFor;   // Optional: called by Build() to rasterize glyphs on your worker threads (stb_truetype builder), default to io.ParallelForFn of the current context when NULL. Call job_func(job_data, n) for every n in [0, job_count), in any order and from any threads, and return once they all returned. Jobs allocate through the functions given to SetAllocatorFunctions() (default: malloc/free), which need to be thread-safe. The texture is identical to a single-threaded build.
+    void*                       BuildParallelForUserData; // User data passed to BuildParallelFor
+    int                         SdfSpread;          // ImFontAtlasFlags_SDF: distance in pixels (at the font size) encoded on each side of the glyph outline, from alpha 0.0 outside to 1.0 inside. Defaults to 4. Larger values allow larger scales, at the cost of texture space.
 
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
@@ -2712,6 +2831,7 @@ struct ImFontAtlas
     int                         TexHeight;          // Texture height calculated during Build().
     ImVec2                      TexUvScale;         // = (1.0f/TexWidth, 1.0f/TexHeight)
     ImVec2                      TexUvWhitePixel;    // Texture coordinates to a white pixel
+    int                         BuildCount;         // Incremented by each build and each texture resize: glyph data and texture coordinates may have changed (e.g. to invalidate caches of glyph quads)
     ImVector<ImFont*>           Fonts;              // Hold all the fonts returned by AddFont*. Fonts[0] is the default font upon calling ImGui::NewFrame(), use ImGui::PushFont()/PopFont() to change the current font.
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      ConfigData;         // Configuration data
@@ -2724,6 +2844,7 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    ImFontAtlasDynamicData*     DynamicData;        // Builder state kept after Build() for ImFontAtlasFlags_DynamicGlyphs
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -2761,8 +2882,10 @@ struct ImFont
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
-    IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
+    IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;             // With ImFontAtlasFlags_DynamicGlyphs, a glyph which isn't rasterized yet returns FallbackGlyph (NULL for FindGlyphNoFallback)
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
+    IMGUI_API const ImFontGlyph*LoadGlyph(ImWchar c);                   // Same as FindGlyph() but rasterize the glyph first if needed (ImFontAtlasFlags_DynamicGlyphs), which may reallocate Glyphs[]: don't keep glyph pointers across calls
+    IMGUI_API const ImFontGlyph*LoadGlyphNoFallback(ImWchar c);
     float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
@@ -3490,6 +3490,43 @@ struct MyItem
     }
 };
 const ImGuiTableSortSpecs* MyItem::s_current_sort_specs = NULL;
+
+// Event log for the table data source demo: the fields of each event are computed from its index, so
+// we can display millions of events without storing them. Your own data would be read from your storage.
+struct MyEventLog
+{
+    static ImU32 Hash(int n)                { ImU32 h = (ImU32)n * 2654435761u; return h ^ (h >> 15); }
+    static int   TimeMs(int n)              { return n * 40 + (int)(Hash(n) % 40); }
+    static int   Severity(int n)            { ImU32 h = Hash(n) % 100; return h < 70 ? 0 : h < 90 ? 1 : h < 98 ? 2 : 3; }
+    static int   Source(int n)              { return (int)((Hash(n) >> 8) % 6); }
+
+    static const char* GetCell(void*, int row_n, int column_n, char* buf, int buf_size)
+    {
+        static const char* severities[] = { "Info", "Warning", "Error", "Fatal" };
+        static const char* sources[] = { "Network", "Renderer", "Audio", "Input", "Scripting", "Physics" };
+        switch (column_n)
+        {
+        case 0: { const int t = TimeMs(row_n); snprintf(buf, (size_t)buf_size, "%02d:%02d:%02d.%03d", t / 3600000 % 24, t / 60000 % 60, t / 1000 % 60, t % 1000); return buf; }
+        case 1: return severities[Severity(row_n)];
+        case 2: return sources[Source(row_n)];
+        case 3: snprintf(buf, (size_t)buf_size, "Event %d, code 0x%04X", row_n, Hash(row_n) & 0xFFFF); return buf;
+        }
+        return NULL;
+    }
+
+    // Compare the values rather than the texts
+    static int CompareRows(void*, int row_a, int row_b, int column_n)
+    {
+        switch (column_n)
+        {
+        case 0: return TimeMs(row_a) - TimeMs(row_b);
+        case 1: return Severity(row_a) - Severity(row_b);
+        case 2: return Source(row_a) - Source(row_b);
+        case 3: return row_a - row_b;
+        }
+        return 0;
+    }
+};
 }
 
 // Make the UI compact because there are so many fields
@@ -4962,6 +4999,41 @@ static void ShowDemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    if (ImGui::TreeNode("Data source"))
+    {
+        HelpMarker(
+            "Instead of submitting rows, TableDataSourceRows() pulls the text of the visible cells from a getter function.\n"
+            "The table handles clipping, sorting (the sorted order is cached until the sort specs change) and column widths.");
+        static int rows_count = 100000;
+        static bool live = false;
+        ImGui::RadioButton("10K events", &rows_count, 10000); ImGui::SameLine();
+        ImGui::RadioButton("100K events", &rows_count, 100000); ImGui::SameLine();
+        ImGui::RadioButton("1M events", &rows_count, 1000000); ImGui::SameLine();
+        ImGui::Checkbox("Live", &live); ImGui::SameLine();
+        HelpMarker("Append events every frame. Only the new rows are sorted and merged into the cached order.");
+        if (live)
+            rows_count = IM_MIN(rows_count + 10, 10000000);
+        ImGui::Text("%d events", rows_count);
+
+        static ImGuiTableFlags flags =
+            ImGuiTableFlags_Resizable | ImGuiTableFlags_Reorderable | ImGuiTableFlags_Hideable | ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti
+            | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingFixedFit;
+        if (ImGui::BeginTable("table_data_source", 4, flags, ImVec2(0.0f, TEXT_BASE_HEIGHT * 15), 0.0f))
+        {
+            ImGui::TableSetupColumn("Time", ImGuiTableColumnFlags_DefaultSort);
+            ImGui::TableSetupColumn("Severity", ImGuiTableColumnFlags_PreferSortDescending);
+            ImGui::TableSetupColumn("Source");
+            ImGui::TableSetupColumn("Message", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupScrollFreeze(0, 1); // Make row always visible
+            ImGui::TableHeadersRow();
+            ImGui::TableDataSourceRows(rows_count, MyEventLog::GetCell, MyEventLog::CompareRows, NULL);
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+
     // In this example we'll expose most table flags and settings.
     // For specific flags and settings refer to the corresponding section for more detailed explanation.
     // This section is mostly useful to experiment with combining certain flags or settings with each others.
@@ -6899,7 +6971,8 @@ static void ShowExampleAppLongText(bool* p_open)
     ImGui::Combo("Test type", &test_type,
         "Single call to TextUnformatted()\0"
         "Multiple calls to Text(), clipped\0"
-        "Multiple calls to Text(), not clipped (slow)\0");
+        "Multiple calls to Text(), not clipped (slow)\0"
+        "Multiple calls to Text() and TextWrapped(), clipped with variable heights\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -6935,6 +7008,28 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Every 10th line is a long wrapped line - demonstrate how to use the ImGuiVariableListClipper helper.
+            // Unlike ImGuiListClipper it needs to persist, and measured heights need to be cleared when the wrap width changes.
+            static ImGuiVariableListClipper clipper;
+            static float wrap_width = 0.0f;
+            if (wrap_width != ImGui::GetContentRegionAvail().x)
+            {
+                wrap_width = ImGui::GetContentRegionAvail().x;
+                clipper.ClearHeights();
+            }
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+            clipper.Begin(lines);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                    if (i % 10 == 0)
+                        ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.", i);
+                    else
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
+            ImGui::PopStyleVar();
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
@@ -13,6 +13,7 @@ Index of this file:
 // [SECTION] Helpers ShadeVertsXXX functions
 // [SECTION] ImFontConfig
 // [SECTION] ImFontAtlas
+// [SECTION] ImFontAtlas build cache
 // [SECTION] ImFontAtlas glyph ranges helpers
 // [SECTION] ImFontGlyphRangesBuilder
 // [SECTION] ImFont
@@ -142,10 +143,15 @@ namespace IMGUI_STB_NAMESPACE
 #endif
 
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
+// Rasterization jobs running on worker threads (ImFontAtlas::BuildParallelFor) set stbtt_fontinfo::userdata to an ImFontBuildJobAllocator:
+// they bypass ImGui::MemAlloc() whose counters and allocation tracker are not thread-safe.
+struct ImFontBuildJobAllocator { ImGuiMemAllocFunc AllocFunc; ImGuiMemFreeFunc FreeFunc; void* UserData; };
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+static inline void* ImStbttAlloc(size_t size, void* u)  { ImFontBuildJobAllocator* a = (ImFontBuildJobAllocator*)u; return a ? a->AllocFunc(size, a->UserData) : IM_ALLOC(size); }
+static inline void  ImStbttFree(void* ptr, void* u)     { ImFontBuildJobAllocator* a = (ImFontBuildJobAllocator*)u; if (a) a->FreeFunc(ptr, a->UserData); else IM_FREE(ptr); }
+#define STBTT_malloc(x,u)   ImStbttAlloc(x,u)
+#define STBTT_free(x,u)     ImStbttFree(x,u)
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -457,6 +463,13 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.IdxOffset = IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
+    if (CmdBuffer.Size == CmdBuffer.Capacity)
+    {
+        ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+        ImGui::SetMemTag(ImGuiMemTag_DrawList);
+        CmdBuffer.reserve(CmdBuffer._grow_capacity(CmdBuffer.Size + 1));
+        ImGui::SetMemTag(backup_mem_tag);
+    }
     CmdBuffer.push_back(draw_cmd);
 }
 
@@ -639,6 +652,18 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     draw_cmd->ElemCount += idx_count;
 
+    // Growing is rare, only tag allocations when it happens (see ImGuiAllocTracker)
+    if (VtxBuffer.Size + vtx_count > VtxBuffer.Capacity || IdxBuffer.Size + idx_count > IdxBuffer.Capacity)
+    {
+        ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+        ImGui::SetMemTag(ImGuiMemTag_DrawList);
+        if (VtxBuffer.Size + vtx_count > VtxBuffer.Capacity)
+            VtxBuffer.reserve(VtxBuffer._grow_capacity(VtxBuffer.Size + vtx_count));
+        if (IdxBuffer.Size + idx_count > IdxBuffer.Capacity)
+            IdxBuffer.reserve(IdxBuffer._grow_capacity(IdxBuffer.Size + idx_count));
+        ImGui::SetMemTag(backup_mem_tag);
+    }
+
     int vtx_buffer_old_size = VtxBuffer.Size;
     VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
     _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
@@ -711,6 +736,84 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Normals (tangents) of the 'segments_count' segments of a polyline: out_normals[i] = normalized perpendicular of (points[i+1] - points[i]), wrapping to points[0].
+// Fixed normals of 'segments_count' joints: out_normals[i+1] = IM_FIXNORMAL2F(average of normals[i] and normals[i+1]), wrapping to out_normals[0].
+// The SSE paths process 4 segments per iteration and perform the exact same operations as the macros above, so their output is bit-identical to the scalar paths.
+// (_mm_rsqrt_ps() and the _mm_rsqrt_ss() used by ImRsqrt() share the same approximation, _mm_div_ps() is correctly rounded).
+static void PolylineComputeNormals(const ImVec2* points, const int points_count, const int segments_count, ImVec2* out_normals)
+{
+    int i1 = 0;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 sign_mask = _mm_set1_ps(-0.0f);
+    for (; i1 + 4 < points_count && i1 + 4 <= segments_count; i1 += 4)
+    {
+        const float* p = &points[i1].x;
+        const __m128 a0 = _mm_loadu_ps(p + 0), a1 = _mm_loadu_ps(p + 4);     // x0 y0 x1 y1 | x2 y2 x3 y3
+        const __m128 b0 = _mm_loadu_ps(p + 2), b1 = _mm_loadu_ps(p + 6);     // x1 y1 x2 y2 | x3 y3 x4 y4
+        __m128 dx = _mm_sub_ps(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128 dy = _mm_sub_ps(_mm_shuffle_ps(b0, b1, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const __m128 mask = _mm_cmpgt_ps(d2, zero);
+        const __m128 inv_len = _mm_or_ps(_mm_and_ps(mask, _mm_rsqrt_ps(d2)), _mm_andnot_ps(mask, one));
+        dx = _mm_mul_ps(dx, inv_len);
+        dy = _mm_mul_ps(dy, inv_len);
+        const __m128 nx = dy;
+        const __m128 ny = _mm_xor_ps(dx, sign_mask);
+        float* out = &out_normals[i1].x;
+        _mm_storeu_ps(out + 0, _mm_unpacklo_ps(nx, ny));
+        _mm_storeu_ps(out + 4, _mm_unpackhi_ps(nx, ny));
+    }
+#endif
+    for (; i1 < segments_count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i1].x = dy;
+        out_normals[i1].y = -dx;
+    }
+}
+
+static void PolylineComputeFixedNormals(const ImVec2* normals, const int points_count, const int segments_count, ImVec2* out_normals)
+{
+    int i1 = 0;
+#ifdef IMGUI_ENABLE_SSE
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 d2_min = _mm_set1_ps(0.000001f);
+    const __m128 inv_len2_max = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; i1 + 4 < points_count && i1 + 4 <= segments_count; i1 += 4)
+    {
+        const float* n = &normals[i1].x;
+        const __m128 a0 = _mm_loadu_ps(n + 0), a1 = _mm_loadu_ps(n + 4);
+        const __m128 b0 = _mm_loadu_ps(n + 2), b1 = _mm_loadu_ps(n + 6);
+        __m128 dm_x = _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(b0, b1, _MM_SHUFFLE(2, 0, 2, 0))), half);
+        __m128 dm_y = _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(b0, b1, _MM_SHUFFLE(3, 1, 3, 1))), half);
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dm_x, dm_x), _mm_mul_ps(dm_y, dm_y));
+        const __m128 mask = _mm_cmpgt_ps(d2, d2_min);
+        const __m128 inv_len2 = _mm_min_ps(_mm_div_ps(one, d2), inv_len2_max);
+        const __m128 scale = _mm_or_ps(_mm_and_ps(mask, inv_len2), _mm_andnot_ps(mask, one));
+        dm_x = _mm_mul_ps(dm_x, scale);
+        dm_y = _mm_mul_ps(dm_y, scale);
+        float* out = &out_normals[i1 + 1].x;
+        _mm_storeu_ps(out + 0, _mm_unpacklo_ps(dm_x, dm_y));
+        _mm_storeu_ps(out + 4, _mm_unpackhi_ps(dm_x, dm_y));
+    }
+#endif
+    for (; i1 < segments_count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dm_x = (normals[i1].x + normals[i2].x) * 0.5f;
+        float dm_y = (normals[i1].y + normals[i2].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_normals[i2].x = dm_x;
+        out_normals[i2].y = dm_y;
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -739,30 +842,25 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         // - If AA_SIZE is not 1.0f we cannot use the texture path.
         const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
 
-        // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
-        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
+        // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines and ImFontAtlasFlags_SDF are off
+        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SDF)));
 
         const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        ImVec2* temp_normals = (ImVec2*)alloca(points_count * ((use_texture || !thick_line) ? 3 : 5) * sizeof(ImVec2)); //-V630
-        ImVec2* temp_points = temp_normals + points_count;
-
-        // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        // The first <points_count> items are normals at each line point, then <points_count> averaged normals at each line point,
+        // then after that there are either 2 or 4 temp points for each line point
+        ImVec2* temp_normals = (ImVec2*)alloca(points_count * ((use_texture || !thick_line) ? 4 : 6) * sizeof(ImVec2)); //-V630
+        ImVec2* temp_fixed_normals = temp_normals + points_count;
+        ImVec2* temp_points = temp_fixed_normals + points_count;
+
+        // Calculate normals (tangents) for each line segment, then averaged normals for each segment end point
+        PolylineComputeNormals(points, points_count, count, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
+        PolylineComputeFixedNormals(temp_normals, points_count, count, temp_fixed_normals);
 
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
@@ -796,11 +894,8 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
                 // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
+                float dm_x = temp_fixed_normals[i2].x * half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
+                float dm_y = temp_fixed_normals[i2].y * half_draw_size;
 
                 // Add temporary vertexes for the outer edges
                 ImVec2* out_vtx = &temp_points[i2 * 2];
@@ -892,9 +987,8 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
                 // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
+                const float dm_x = temp_fixed_normals[i2].x;
+                const float dm_y = temp_fixed_normals[i2].y;
                 float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
                 float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
                 float dm_in_x = dm_x * half_inner_thickness;
@@ -994,29 +1088,17 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             _IdxWritePtr += 3;
         }
 
-        // Compute normals
-        ImVec2* temp_normals = (ImVec2*)alloca(points_count * sizeof(ImVec2)); //-V630
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        // Compute normals, then averaged normals at each point
+        ImVec2* temp_normals = (ImVec2*)alloca(points_count * 2 * sizeof(ImVec2)); //-V630
+        ImVec2* temp_fixed_normals = temp_normals + points_count;
+        PolylineComputeNormals(points, points_count, points_count, temp_normals);
+        PolylineComputeFixedNormals(temp_normals, points_count, points_count, temp_fixed_normals);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
             // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
+            float dm_x = temp_fixed_normals[i1].x * (AA_SIZE * 0.5f);
+            float dm_y = temp_fixed_normals[i1].y * (AA_SIZE * 0.5f);
 
             // Add vertices
             _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
@@ -1522,6 +1604,211 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
     PathFillConvex(col);
 }
 
+// Number of shapes of 'vtx_count' vertices to reserve at once in batch functions.
+// With 16-bit indices, fill what is left of the current 64K vertices window first: PrimReserve() then switches VtxOffset at the same point as it would with one call per shape.
+static int CalcBatchRunMax(unsigned int vtx_current_idx, int vtx_count, int count)
+{
+    if (sizeof(ImDrawIdx) != 2)
+        return count;
+    const int room = ((1 << 16) - 1 - (int)vtx_current_idx) / vtx_count;
+    return (room > 0) ? room : ImMax(1, ((1 << 16) - 1) / vtx_count);
+}
+
+// Same output as calling AddCircleFilled() for each center (within float precision), but the circle is tessellated once:
+// each circle then only costs scaling/translating the template vertices and offsetting the template indices.
+void ImDrawList::AddCircleFilledBatch(const ImVec2* centers, int centers_count, float radius, ImU32 col, int num_segments)
+{
+    if ((col & IM_COL32_A_MASK) == 0 || radius <= 0.0f)
+        return;
+    _AddCircleFilledBatch(centers, NULL, radius, NULL, col, centers_count, num_segments);
+}
+
+void ImDrawList::AddCircleFilledBatch(const ImVec2* centers, const float* radii, const ImU32* cols, int count, int num_segments)
+{
+    _AddCircleFilledBatch(centers, radii, 0.0f, cols, 0, count, num_segments);
+}
+
+// 'radii'/'cols' may be NULL to use 'radius'/'col' for all circles.
+// The template is a unit circle built with the same samples as AddCircleFilled() (so vertex positions match exactly without anti-aliasing),
+// it is rebuilt whenever the automatic segment count changes between two consecutive circles: sort by radius to get the most out of it.
+void ImDrawList::_AddCircleFilledBatch(const ImVec2* centers, const float* radii, float radius, const ImU32* cols, ImU32 col, int count, int num_segments)
+{
+    const bool explicit_segments = (num_segments > 0);
+    if (explicit_segments)
+        num_segments = ImClamp(num_segments, 3, IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_MAX);
+    const int points_max = explicit_segments ? num_segments : IM_DRAWLIST_ARCFAST_SAMPLE_MAX;
+    const bool anti_aliased = (Flags & ImDrawListFlags_AntiAliasedFill) != 0;
+    const float AA_SIZE = _FringeScale;
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+
+    // Template storage: unit circle points, fixed normals (pre-scaled by half the AA fringe), indices
+    ImVec2* temp_points = (ImVec2*)alloca(points_max * 3 * sizeof(ImVec2)); //-V630
+    ImVec2* temp_normals = temp_points + points_max;
+    ImVec2* temp_fixed_normals = temp_normals + points_max;
+    unsigned int* temp_idx = (unsigned int*)alloca((points_max * 9) * sizeof(unsigned int));
+    int template_step = -1;
+    int vtx_count = 0, idx_count = 0, points_count = 0;
+
+    IM_ASSERT(_Path.Size == 0);
+    int n = 0;
+    while (n < count)
+    {
+        const float r = radii ? radii[n] : radius;
+        if (((cols ? cols[n] : col) & IM_COL32_A_MASK) == 0 || r <= 0.0f)
+        {
+            n++;
+            continue;
+        }
+
+        // (Re)build template
+        const int step = explicit_segments ? num_segments : ImClamp(IM_DRAWLIST_ARCFAST_SAMPLE_MAX / _CalcCircleAutoSegmentCount(r), 1, IM_DRAWLIST_ARCFAST_TABLE_SIZE / 4);
+        if (step != template_step)
+        {
+            template_step = step;
+            if (explicit_segments)
+                PathArcTo(ImVec2(0.0f, 0.0f), 1.0f, 0.0f, (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments, num_segments - 1);
+            else
+                _PathArcToFastEx(ImVec2(0.0f, 0.0f), 1.0f, 0, IM_DRAWLIST_ARCFAST_SAMPLE_MAX, step);
+            if (!explicit_segments)
+                _Path.Size--;
+            points_count = _Path.Size;
+            IM_ASSERT(points_count >= 3 && points_count <= points_max);
+            memcpy(temp_points, _Path.Data, points_count * sizeof(ImVec2));
+            _Path.Size = 0;
+
+            unsigned int* out_idx = temp_idx;
+            if (anti_aliased)
+            {
+                // Same layout as AddConvexPolyFilled(): inner/outer vertex pairs, fan indices then fringe indices
+                PolylineComputeNormals(temp_points, points_count, points_count, temp_normals);
+                PolylineComputeFixedNormals(temp_normals, points_count, points_count, temp_fixed_normals);
+                for (int i = 0; i < points_count; i++)
+                    temp_fixed_normals[i] = temp_fixed_normals[i] * (AA_SIZE * 0.5f);
+                for (int i = 2; i < points_count; i++, out_idx += 3)
+                {
+                    out_idx[0] = 0; out_idx[1] = (i - 1) << 1; out_idx[2] = i << 1;
+                }
+                for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++, out_idx += 6)
+                {
+                    out_idx[0] = (i1 << 1); out_idx[1] = (i0 << 1); out_idx[2] = (i0 << 1) + 1;
+                    out_idx[3] = (i0 << 1) + 1; out_idx[4] = (i1 << 1) + 1; out_idx[5] = (i1 << 1);
+                }
+                vtx_count = points_count * 2;
+            }
+            else
+            {
+                for (int i = 2; i < points_count; i++, out_idx += 3)
+                {
+                    out_idx[0] = 0; out_idx[1] = i - 1; out_idx[2] = i;
+                }
+                vtx_count = points_count;
+            }
+            idx_count = (int)(out_idx - temp_idx);
+        }
+
+        // Find the run of circles sharing this template, up to what fits in 16-bit indices
+        // so PrimReserve() can switch VtxOffset between runs when large meshes are supported.
+        const int run_max = CalcBatchRunMax(_VtxCurrentIdx, vtx_count, count);
+        int run_end = n + 1;
+        int run_count = 1;
+        while (run_end < count && run_count < run_max)
+        {
+            const float r2 = radii ? radii[run_end] : radius;
+            const bool skip = ((cols ? cols[run_end] : col) & IM_COL32_A_MASK) == 0 || r2 <= 0.0f;
+            if (!skip && !explicit_segments && radii && ImClamp(IM_DRAWLIST_ARCFAST_SAMPLE_MAX / _CalcCircleAutoSegmentCount(r2), 1, IM_DRAWLIST_ARCFAST_TABLE_SIZE / 4) != template_step)
+                break;
+            run_end++;
+            if (!skip)
+                run_count++;
+        }
+
+        // Write vertices and indices
+        PrimReserve(idx_count * run_count, vtx_count * run_count);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int vtx_base = _VtxCurrentIdx;
+        for (; n < run_end; n++)
+        {
+            const float cr = radii ? radii[n] : radius;
+            const ImU32 cc = cols ? cols[n] : col;
+            if ((cc & IM_COL32_A_MASK) == 0 || cr <= 0.0f)
+                continue;
+            const float cx = centers[n].x;
+            const float cy = centers[n].y;
+            if (anti_aliased)
+            {
+                const ImU32 cc_trans = cc & ~IM_COL32_A_MASK;
+                for (int i = 0; i < points_count; i++, vtx_write += 2)
+                {
+                    const float px = cx + temp_points[i].x * cr;
+                    const float py = cy + temp_points[i].y * cr;
+                    vtx_write[0].pos.x = px - temp_fixed_normals[i].x; vtx_write[0].pos.y = py - temp_fixed_normals[i].y; vtx_write[0].uv = uv; vtx_write[0].col = cc;         // Inner
+                    vtx_write[1].pos.x = px + temp_fixed_normals[i].x; vtx_write[1].pos.y = py + temp_fixed_normals[i].y; vtx_write[1].uv = uv; vtx_write[1].col = cc_trans;   // Outer
+                }
+            }
+            else
+            {
+                for (int i = 0; i < points_count; i++, vtx_write++)
+                {
+                    vtx_write[0].pos.x = cx + temp_points[i].x * cr;
+                    vtx_write[0].pos.y = cy + temp_points[i].y * cr;
+                    vtx_write[0].uv = uv;
+                    vtx_write[0].col = cc;
+                }
+            }
+            for (int i = 0; i < idx_count; i++)
+                idx_write[i] = (ImDrawIdx)(vtx_base + temp_idx[i]);
+            idx_write += idx_count;
+            vtx_base += vtx_count;
+        }
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = vtx_base;
+    }
+}
+
+// Same output as calling AddRectFilled(p_min[n], p_min[n] + sizes[n], cols[n]) for each rectangle, without rounding.
+void ImDrawList::AddRectFilledBatch(const ImVec2* p_min, const ImVec2* sizes, const ImU32* cols, int count)
+{
+    const ImVec2 uv = _Data->TexUvWhitePixel;
+    int n = 0;
+    while (n < count)
+    {
+        // Reserve for a run of rectangles, give back what was reserved for fully transparent ones
+        const int run_end = ImMin(n + CalcBatchRunMax(_VtxCurrentIdx, 4, count), count);
+        PrimReserve((run_end - n) * 6, (run_end - n) * 4);
+        ImDrawVert* vtx_write = _VtxWritePtr;
+        ImDrawIdx* idx_write = _IdxWritePtr;
+        unsigned int idx = _VtxCurrentIdx;
+        int skipped = 0;
+        for (; n < run_end; n++)
+        {
+            const ImU32 col = cols[n];
+            if ((col & IM_COL32_A_MASK) == 0)
+            {
+                skipped++;
+                continue;
+            }
+            const float x1 = p_min[n].x, y1 = p_min[n].y;
+            const float x2 = x1 + sizes[n].x, y2 = y1 + sizes[n].y;
+            idx_write[0] = (ImDrawIdx)idx; idx_write[1] = (ImDrawIdx)(idx + 1); idx_write[2] = (ImDrawIdx)(idx + 2);
+            idx_write[3] = (ImDrawIdx)idx; idx_write[4] = (ImDrawIdx)(idx + 2); idx_write[5] = (ImDrawIdx)(idx + 3);
+            vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].uv = uv; vtx_write[0].col = col;
+            vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].uv = uv; vtx_write[1].col = col;
+            vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].uv = uv; vtx_write[2].col = col;
+            vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].uv = uv; vtx_write[3].col = col;
+            vtx_write += 4;
+            idx_write += 6;
+            idx += 4;
+        }
+        _VtxWritePtr = vtx_write;
+        _IdxWritePtr = idx_write;
+        _VtxCurrentIdx = idx;
+        if (skipped > 0)
+            PrimUnreserve(skipped * 6, skipped * 4);
+    }
+}
+
 // Guaranteed to honor 'num_segments'
 void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_segments, float thickness)
 {
@@ -1688,8 +1975,11 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
     int old_channels_count = _Channels.Size;
     if (old_channels_count < channels_count)
     {
+        ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+        ImGui::SetMemTag(ImGuiMemTag_DrawList);
         _Channels.reserve(channels_count); // Avoid over reserving since this is likely to stay stable
         _Channels.resize(channels_count);
+        ImGui::SetMemTag(backup_mem_tag);
     }
     _Count = channels_count;
 
@@ -1969,6 +2259,7 @@ ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
     TexGlyphPadding = 1;
+    SdfSpread = 4;
     PackIdMouseCursors = PackIdLines = -1;
 }
 
@@ -1998,6 +2289,7 @@ void    ImFontAtlas::ClearInputData()
     ConfigData.clear();
     CustomRects.clear();
     PackIdMouseCursors = PackIdLines = -1;
+    ImFontAtlasBuildDestroyDynamicData(this);
     // Important: we leave TexReady untouched
 }
 
@@ -2011,6 +2303,7 @@ void    ImFontAtlas::ClearTexData()
     TexPixelsAlpha8 = NULL;
     TexPixelsRGBA32 = NULL;
     TexPixelsUseColors = false;
+    ImFontAtlasBuildDestroyDynamicData(this); // Glyphs not rasterized yet will use the fallback glyph
     // Important: we leave TexReady untouched
 }
 
@@ -2050,7 +2343,10 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
         GetTexDataAsAlpha8(&pixels, NULL, NULL);
         if (pixels)
         {
+            ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+            ImGui::SetMemTag(ImGuiMemTag_Font);
             TexPixelsRGBA32 = (unsigned int*)IM_ALLOC((size_t)TexWidth * (size_t)TexHeight * 4);
+            ImGui::SetMemTag(backup_mem_tag);
             const unsigned char* src = pixels;
             unsigned int* dst = TexPixelsRGBA32;
             for (int n = TexWidth * TexHeight; n > 0; n--)
@@ -2069,6 +2365,8 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
+    ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+    ImGui::SetMemTag(ImGuiMemTag_Font);
 
     // Create new font
     if (!font_cfg->MergeMode)
@@ -2093,6 +2391,7 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
     // Invalidate texture
     TexReady = false;
     ClearTexData();
+    ImGui::SetMemTag(backup_mem_tag);
     return new_font_cfg.DstFont;
 }
 
@@ -2138,7 +2437,10 @@ ImFont* ImFontAtlas::AddFontFromFileTTF(const char* filename, float size_pixels,
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     size_t data_size = 0;
+    ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+    ImGui::SetMemTag(ImGuiMemTag_Font);
     void* data = ImFileLoadToMemory(filename, "rb", &data_size, 0);
+    ImGui::SetMemTag(backup_mem_tag);
     if (!data)
     {
         IM_ASSERT_USER_ERROR(0, "Could not load font file!");
@@ -2172,7 +2474,10 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* ttf_data, int ttf_size, float si
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
     const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
+    ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+    ImGui::SetMemTag(ImGuiMemTag_Font);
     unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
+    ImGui::SetMemTag(backup_mem_tag);
     stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
 
     ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
@@ -2276,7 +2581,11 @@ bool    ImFontAtlas::Build()
     }
 
     // Build
-    return builder_io->FontBuilder_Build(this);
+    ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+    ImGui::SetMemTag(ImGuiMemTag_Font);
+    bool ret = builder_io->FontBuilder_Build(this);
+    ImGui::SetMemTag(backup_mem_tag);
+    return ret;
 }
 
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
@@ -2322,6 +2631,25 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// Builder state kept after the build with ImFontAtlasFlags_DynamicGlyphs, to rasterize glyphs on first use.
+struct ImFontAtlasDynamicSrc
+{
+    stbtt_fontinfo      FontInfo;           // Points into ImFontConfig::FontData, so this is destroyed by ClearInputData()
+    float               Scale;              // Same as the scale used by stbtt_PackFontRangesRenderIntoRects()
+};
+
+struct ImFontAtlasDynamicData
+{
+    ImVector<ImFontAtlasDynamicSrc> Sources;    // One per atlas->ConfigData[]
+    stbtt_pack_context  PackContext;        // Packer left open by the build. Its height is kept to the texture height.
+    int                 TexHeightMax;
+    bool                GrowRequested;      // A glyph didn't fit: double the texture height in the next NewFrame()
+    int                 DirtyX0, DirtyY0, DirtyX1, DirtyY1;   // Pixels changed since the last GetTexDataDirtyRect()
+    int                 GlyphsRasterized;   // Glyphs rasterized after the build (for statistics)
+
+    ImFontAtlasDynamicData() { memset(this, 0, sizeof(*this)); }
+};
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2334,6 +2662,98 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+// Rasterize a range of glyphs of one source, for step 8 of ImFontAtlasBuildWithStbTruetype()
+struct ImFontBuildRasterizeJob
+{
+    int                 SrcIndex;
+    int                 GlyphStart;
+    int                 GlyphCount;
+};
+
+struct ImFontBuildRasterizeJobs
+{
+    ImFontAtlas*                        Atlas;
+    ImFontBuildSrcData*                 SrcTmpArray;
+    const stbtt_pack_context*           PackContext;
+    ImFontBuildJobAllocator*            Allocator;      // NULL when running on the calling thread
+    ImVector<ImFontBuildRasterizeJob>   Jobs;
+};
+
+// ImFontAtlasFlags_SDF: render distance fields into the packed rectangles and fill the packed chars ourselves,
+// as stb_truetype has no packing API for them. Same layout as stbtt_PackFontRangesRenderIntoRects() with no oversampling.
+static void ImFontAtlasBuildRenderGlyphsSDF(ImFontAtlas* atlas, const stbtt_fontinfo* font_info, const ImFontConfig& cfg, const int* codepoints, const stbrp_rect* rects, stbtt_packedchar* packed_chars, int count)
+{
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(font_info, -cfg.SizePixels);
+    const int spread = atlas->SdfSpread;
+    const unsigned char onedge_value = 128;
+    const float pixel_dist_scale = (float)onedge_value / spread;
+    for (int glyph_i = 0; glyph_i < count; glyph_i++)
+    {
+        const stbrp_rect& r = rects[glyph_i];
+        stbtt_packedchar& pc = packed_chars[glyph_i];
+        if (!r.was_packed)
+            continue;
+        const int glyph_index_in_font = stbtt_FindGlyphIndex(font_info, codepoints[glyph_i]);
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(font_info, glyph_index_in_font, &advance, &lsb);
+        int w = 0, h = 0, x_off = 0, y_off = 0;
+        unsigned char* sdf = stbtt_GetGlyphSDF(font_info, scale, glyph_index_in_font, spread, onedge_value, pixel_dist_scale, &w, &h, &x_off, &y_off);
+        if (sdf != NULL)
+        {
+            IM_ASSERT(w <= r.w && h <= r.h);
+            unsigned char* dst = atlas->TexPixelsAlpha8 + r.x + r.y * atlas->TexWidth;
+            for (int y = 0; y < h; y++, dst += atlas->TexWidth)
+                memcpy(dst, sdf + y * w, (size_t)w);
+            stbtt_FreeSDF(sdf, font_info->userdata);
+        }
+        pc.x0 = (unsigned short)r.x;
+        pc.y0 = (unsigned short)r.y;
+        pc.x1 = (unsigned short)(r.x + w);
+        pc.y1 = (unsigned short)(r.y + h);
+        pc.xoff = (float)x_off;
+        pc.yoff = (float)y_off;
+        pc.xoff2 = (float)(x_off + w);
+        pc.yoff2 = (float)(y_off + h);
+        pc.xadvance = scale * advance;
+    }
+}
+
+static void ImFontAtlasBuildRasterizeJob(void* job_data, int job_index)
+{
+    ImFontBuildRasterizeJobs* jobs = (ImFontBuildRasterizeJobs*)job_data;
+    const ImFontBuildRasterizeJob& job = jobs->Jobs[job_index];
+    ImFontAtlas* atlas = jobs->Atlas;
+    const ImFontConfig& cfg = atlas->ConfigData[job.SrcIndex];
+    ImFontBuildSrcData& src_tmp = jobs->SrcTmpArray[job.SrcIndex];
+
+    // Private copies: stbtt_PackFontRangesRenderIntoRects() temporarily modifies the pack context, and stbtt_fontinfo holds the allocator
+    stbtt_pack_context spc = *jobs->PackContext;
+    stbtt_fontinfo font_info = src_tmp.FontInfo;
+    font_info.userdata = jobs->Allocator;
+    if (atlas->Flags & ImFontAtlasFlags_SDF)
+    {
+        ImFontAtlasBuildRenderGlyphsSDF(atlas, &font_info, cfg, src_tmp.GlyphsList.Data + job.GlyphStart, src_tmp.Rects + job.GlyphStart, src_tmp.PackedChars + job.GlyphStart, job.GlyphCount);
+        return;
+    }
+    stbtt_pack_range pack_range = src_tmp.PackRange;
+    pack_range.array_of_unicode_codepoints += job.GlyphStart;
+    pack_range.chardata_for_range += job.GlyphStart;
+    pack_range.num_chars = job.GlyphCount;
+    stbrp_rect* rects = src_tmp.Rects + job.GlyphStart;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &pack_range, 1, rects);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = rects;
+        for (int glyph_i = 0; glyph_i < job.GlyphCount; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+    }
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -2387,6 +2807,24 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         dst_tmp.GlyphsHighest = ImMax(dst_tmp.GlyphsHighest, src_tmp.GlyphsHighest);
     }
 
+    // With ImFontAtlasFlags_DynamicGlyphs we only build ASCII here and keep what we need to rasterize other glyphs on first use.
+    // See ImFontAtlasBuildDynamicMarkPending() and ImFontAtlasBuildDynamicGlyph().
+    const bool sdf = (atlas->Flags & ImFontAtlasFlags_SDF) != 0;
+    const bool dynamic_glyphs = (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) != 0 && !sdf;
+    IM_ASSERT((!sdf || atlas->SdfSpread > 0) && "ImFontAtlasFlags_SDF needs a SdfSpread of at least 1 pixel.");
+    if (dynamic_glyphs)
+    {
+        ImFontAtlasDynamicData* dynamic_data = atlas->DynamicData = IM_NEW(ImFontAtlasDynamicData)();
+        dynamic_data->Sources.resize(src_tmp_array.Size);
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            ImFontAtlasDynamicSrc& dyn_src = dynamic_data->Sources[src_i];
+            const float size_pixels = atlas->ConfigData[src_i].SizePixels;
+            dyn_src.FontInfo = src_tmp_array[src_i].FontInfo;
+            dyn_src.Scale = (size_pixels > 0) ? stbtt_ScaleForPixelHeight(&dyn_src.FontInfo, size_pixels) : stbtt_ScaleForMappingEmToPixels(&dyn_src.FontInfo, -size_pixels);
+        }
+    }
+
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
     int total_glyphs_count = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -2400,6 +2838,8 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
             for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
             {
+                if (dynamic_glyphs && codepoint >= 0x80)     // Rasterized on first use
+                    break;
                 if (dst_tmp.GlyphsSet.TestBit(codepoint))    // Don't overwrite existing glyphs. We could make this an option for MergeMode (e.g. MergeOverwrite==true)
                     continue;
                 if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
@@ -2458,10 +2898,13 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.array_of_unicode_codepoints = src_tmp.GlyphsList.Data;
         src_tmp.PackRange.num_chars = src_tmp.GlyphsList.Size;
         src_tmp.PackRange.chardata_for_range = src_tmp.PackedChars;
-        src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
-        src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
+        const int oversample_h = sdf ? 1 : cfg.OversampleH;
+        const int oversample_v = sdf ? 1 : cfg.OversampleV;
+        src_tmp.PackRange.h_oversample = (unsigned char)oversample_h;
+        src_tmp.PackRange.v_oversample = (unsigned char)oversample_v;
 
         // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
+        // Distance fields extend SdfSpread pixels around non-empty glyphs (see stbtt_GetGlyphSDF)
         const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
         const int padding = atlas->TexGlyphPadding;
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
@@ -2469,9 +2912,10 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * oversample_h, scale * oversample_v, 0, 0, &x0, &y0, &x1, &y1);
+            const int sdf_spread = (sdf && x0 != x1 && y0 != y1) ? atlas->SdfSpread * 2 : 0;
+            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + sdf_spread + padding + oversample_h - 1);
+            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + sdf_spread + padding + oversample_v - 1);
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
         }
     }
@@ -2511,6 +2955,8 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     // 7. Allocate texture
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
+    if (dynamic_glyphs)
+        atlas->TexHeight *= 2;  // Leave room for glyphs rasterized on first use
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
     memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
@@ -2518,30 +2964,63 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    // Glyphs are split into jobs of RASTERIZE_JOB_GLYPHS, which can run in parallel (see ImFontAtlas::BuildParallelFor): each glyph only writes to its own rectangle.
+    const int RASTERIZE_JOB_GLYPHS = 64;
+    ImFontBuildRasterizeJobs jobs;
+    jobs.Atlas = atlas;
+    jobs.SrcTmpArray = src_tmp_array.Data;
+    jobs.PackContext = &spc;
+    jobs.Allocator = NULL;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i += RASTERIZE_JOB_GLYPHS)
+        {
+            ImFontBuildRasterizeJob job;
+            job.SrcIndex = src_i;
+            job.GlyphStart = glyph_i;
+            job.GlyphCount = ImMin(RASTERIZE_JOB_GLYPHS, src_tmp_array[src_i].GlyphsCount - glyph_i);
+            jobs.Jobs.push_back(job);
+        }
+    ImGuiParallelForFunc parallel_for = atlas->BuildParallelFor;
+    void* parallel_for_user_data = atlas->BuildParallelForUserData;
+    if (parallel_for == NULL && GImGui != NULL)
     {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        parallel_for = GImGui->IO.ParallelForFn;
+        parallel_for_user_data = GImGui->IO.ParallelForUserData;
+    }
+    if (parallel_for != NULL && jobs.Jobs.Size > 1)
+    {
+        ImFontBuildJobAllocator allocator;
+        ImGui::GetAllocatorFunctions(&allocator.AllocFunc, &allocator.FreeFunc, &allocator.UserData);
+        if (ImGuiAllocTracker* tracker = ImGui::GetAllocTracker())
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            allocator.AllocFunc = tracker->ChainAllocFunc;
+            allocator.FreeFunc = tracker->ChainFreeFunc;
+            allocator.UserData = tracker->ChainUserData;
         }
-        src_tmp.Rects = NULL;
+        jobs.Allocator = &allocator;
+        parallel_for(ImFontAtlasBuildRasterizeJob, &jobs, jobs.Jobs.Size, parallel_for_user_data);
+    }
+    else
+    {
+        for (int job_i = 0; job_i < jobs.Jobs.Size; job_i++)
+            ImFontAtlasBuildRasterizeJob(&jobs, job_i);
     }
+    jobs.Jobs.clear();
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
 
     // End packing
-    stbtt_PackEnd(&spc);
+    // With ImFontAtlasFlags_DynamicGlyphs we keep the packer to add glyphs later, limited to the texture height (it is grown by ImFontAtlasUpdateDynamicGlyphs)
+    if (dynamic_glyphs)
+    {
+        ((stbrp_context*)spc.pack_info)->height = atlas->TexHeight - atlas->TexGlyphPadding;
+        atlas->DynamicData->PackContext = spc;
+        atlas->DynamicData->TexHeightMax = TEX_HEIGHT_MAX;
+    }
+    else
+    {
+        stbtt_PackEnd(&spc);
+    }
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
@@ -2583,6 +3062,10 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     src_tmp_array.clear_destruct();
 
     ImFontAtlasBuildFinish(atlas);
+
+    // Glyphs rasterized by ImFontAtlasBuildFinish() (e.g. ellipsis, fallback) are part of the initial texture
+    if (ImFontAtlasDynamicData* dynamic_data = atlas->DynamicData)
+        dynamic_data->DirtyX0 = dynamic_data->DirtyY0 = dynamic_data->DirtyX1 = dynamic_data->DirtyY1 = 0;
     return true;
 }
 
@@ -2593,6 +3076,280 @@ const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
     return &io;
 }
 
+//-------------------------------------------------------------------------
+// ImFontAtlasFlags_DynamicGlyphs
+//-------------------------------------------------------------------------
+// - The build only rasterizes ASCII. Other glyphs available in the sources get IM_FONTGLYPH_INDEX_PENDING in
+//   ImFont::IndexLookup[] along with their final advance, so text can be measured without rasterizing anything.
+// - ImFont::LoadGlyph(), called when rendering text, rasterizes a pending glyph into the free space of the texture
+//   the first time it is used, and the backend uploads GetTexDataDirtyRect() before rendering. FindGlyph() doesn't.
+// - When the texture is full we use the fallback glyph for the rest of the frame, and double the texture height
+//   in the next NewFrame() (all UV are rescaled, the backend needs to upload the whole texture).
+//-------------------------------------------------------------------------
+
+// Same adjustments as ImFont::AddGlyph(), so the advance of a pending glyph doesn't change once it is rasterized.
+static float ImFontAtlasBuildDynamicAdvanceX(const ImFontConfig* cfg, float advance_x)
+{
+    advance_x = ImClamp(advance_x, cfg->GlyphMinAdvanceX, cfg->GlyphMaxAdvanceX);
+    if (cfg->PixelSnapH)
+        advance_x = IM_ROUND(advance_x);
+    return advance_x + cfg->GlyphExtraSpacing.x;
+}
+
+static void ImFontAtlasBuildDynamicSetMissing(ImFont* font, ImWchar codepoint)
+{
+    font->IndexLookup[codepoint] = (ImWchar)-1;
+    font->IndexAdvanceX[codepoint] = font->FallbackGlyph ? font->FallbackAdvanceX : -1.0f; // -1.0f gets fixed by BuildLookupTable()
+}
+
+// Called by ImFont::BuildLookupTable(), after indexing the glyphs that are already rasterized.
+// Sources are visited in the same order as the build, so the first source providing a codepoint wins.
+void ImFontAtlasBuildDynamicMarkPending(ImFontAtlas* atlas, ImFont* font)
+{
+    ImFontAtlasDynamicData* dynamic_data = atlas->DynamicData;
+    for (int src_i = 0; src_i < dynamic_data->Sources.Size && src_i < atlas->ConfigData.Size; src_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[src_i];
+        if (cfg.DstFont != font)
+            continue;
+        const ImFontAtlasDynamicSrc& dyn_src = dynamic_data->Sources[src_i];
+        const ImWchar* src_ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        for (const ImWchar* src_range = src_ranges; src_range[0] && src_range[1]; src_range += 2)
+        {
+            font->GrowIndex((int)src_range[1] + 1);
+            for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
+            {
+                if (font->IndexLookup.Data[codepoint] != (ImWchar)-1)   // Already rasterized, or pending from an earlier source
+                    continue;
+                const int glyph_index = stbtt_FindGlyphIndex(&dyn_src.FontInfo, codepoint);
+                if (glyph_index == 0)
+                    continue;
+                int advance, lsb;
+                stbtt_GetGlyphHMetrics(&dyn_src.FontInfo, glyph_index, &advance, &lsb);
+                font->IndexLookup.Data[codepoint] = IM_FONTGLYPH_INDEX_PENDING;
+                font->IndexAdvanceX.Data[codepoint] = ImFontAtlasBuildDynamicAdvanceX(&cfg, dyn_src.Scale * advance);
+
+                // Mark 4K page as used
+                const int page_n = codepoint / 4096;
+                font->Used4kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
+            }
+        }
+    }
+}
+
+// Rasterize a pending glyph into the texture. Return NULL if the codepoint is not available or doesn't fit in the texture.
+const ImFontGlyph* ImFontAtlasBuildDynamicGlyph(ImFontAtlas* atlas, ImFont* font, ImWchar codepoint)
+{
+    ImFontAtlasDynamicData* dynamic_data = atlas->DynamicData;
+    IM_ASSERT(dynamic_data != NULL && font->IndexLookup[codepoint] == IM_FONTGLYPH_INDEX_PENDING);
+    if (dynamic_data->GrowRequested)
+        return NULL;    // Texture is full until the next NewFrame()
+
+    // Find source font
+    int src_i = 0;
+    int glyph_index = 0;
+    for (; src_i < dynamic_data->Sources.Size && src_i < atlas->ConfigData.Size && glyph_index == 0; src_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[src_i];
+        if (cfg.DstFont != font)
+            continue;
+        const ImWchar* src_ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        for (const ImWchar* src_range = src_ranges; src_range[0] && src_range[1] && glyph_index == 0; src_range += 2)
+            if (codepoint >= src_range[0] && codepoint <= src_range[1])
+                glyph_index = stbtt_FindGlyphIndex(&dynamic_data->Sources[src_i].FontInfo, codepoint);
+    }
+    if (glyph_index == 0 || font->Glyphs.Size + 1 >= 0xFFFE) // See BuildLookupTable()
+    {
+        ImFontAtlasBuildDynamicSetMissing(font, codepoint);
+        return NULL;
+    }
+    src_i--;
+    const ImFontConfig& cfg = atlas->ConfigData[src_i];
+    const ImFontAtlasDynamicSrc& dyn_src = dynamic_data->Sources[src_i];
+
+    // Pack (same rectangle size as the build)
+    const int padding = atlas->TexGlyphPadding;
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBoxSubpixel(&dyn_src.FontInfo, glyph_index, dyn_src.Scale * cfg.OversampleH, dyn_src.Scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    stbrp_rect r;
+    memset(&r, 0, sizeof(r));
+    r.w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+    r.h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+    stbrp_pack_rects((stbrp_context*)dynamic_data->PackContext.pack_info, &r, 1);
+    if (!r.was_packed)
+    {
+        if (r.w <= atlas->TexWidth - padding && atlas->TexHeight * 2 <= dynamic_data->TexHeightMax)
+            dynamic_data->GrowRequested = true;
+        else
+            ImFontAtlasBuildDynamicSetMissing(font, codepoint);
+        return NULL;
+    }
+    const int rect_x = r.x, rect_y = r.y, rect_w = r.w, rect_h = r.h;
+
+    // Render
+    ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+    ImGui::SetMemTag(ImGuiMemTag_Font);
+    IM_ASSERT(atlas->TexPixelsAlpha8 != NULL);
+    int codepoint_int = (int)codepoint;
+    stbtt_packedchar pc;
+    memset(&pc, 0, sizeof(pc));
+    stbtt_pack_range pack_range;
+    memset(&pack_range, 0, sizeof(pack_range));
+    pack_range.font_size = cfg.SizePixels;
+    pack_range.array_of_unicode_codepoints = &codepoint_int;
+    pack_range.num_chars = 1;
+    pack_range.chardata_for_range = &pc;
+    pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+    pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+    stbtt_pack_context& spc = dynamic_data->PackContext;
+    spc.pixels = atlas->TexPixelsAlpha8;
+    spc.height = atlas->TexHeight;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &dyn_src.FontInfo, &pack_range, 1, &r);
+    if (cfg.RasterizerMultiply != 1.0f && r.was_packed)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r.x, r.y, r.w, r.h, atlas->TexWidth * 1);
+    }
+    if (atlas->TexPixelsRGBA32 != NULL)
+        for (int y = rect_y; y < rect_y + rect_h; y++)
+        {
+            const unsigned char* src = atlas->TexPixelsAlpha8 + y * atlas->TexWidth + rect_x;
+            unsigned int* dst = atlas->TexPixelsRGBA32 + y * atlas->TexWidth + rect_x;
+            for (int n = rect_w; n > 0; n--)
+                *dst++ = IM_COL32(255, 255, 255, (unsigned int)(*src++));
+        }
+
+    // Register glyph (same as the build). Glyphs[] may be reallocated, FallbackGlyph points into it.
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(font->Ascent);
+    stbtt_aligned_quad q;
+    float unused_x = 0.0f, unused_y = 0.0f;
+    stbtt_GetPackedQuad(&pc, atlas->TexWidth, atlas->TexHeight, 0, &unused_x, &unused_y, &q, 0);
+    const int fallback_glyph_index = font->FallbackGlyph ? (int)(font->FallbackGlyph - font->Glyphs.Data) : -1;
+    font->AddGlyph(&cfg, codepoint, q.x0 + font_off_x, q.y0 + font_off_y, q.x1 + font_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, pc.xadvance);
+    font->DirtyLookupTables = false;
+    if (fallback_glyph_index != -1)
+        font->FallbackGlyph = &font->Glyphs.Data[fallback_glyph_index];
+    font->IndexLookup[codepoint] = (ImWchar)(font->Glyphs.Size - 1);
+    font->IndexAdvanceX[codepoint] = font->Glyphs.back().AdvanceX;
+    ImGui::SetMemTag(backup_mem_tag);
+
+    if (dynamic_data->DirtyX1 <= dynamic_data->DirtyX0)
+    {
+        dynamic_data->DirtyX0 = rect_x;
+        dynamic_data->DirtyY0 = rect_y;
+        dynamic_data->DirtyX1 = rect_x + rect_w;
+        dynamic_data->DirtyY1 = rect_y + rect_h;
+    }
+    else
+    {
+        dynamic_data->DirtyX0 = ImMin(dynamic_data->DirtyX0, rect_x);
+        dynamic_data->DirtyY0 = ImMin(dynamic_data->DirtyY0, rect_y);
+        dynamic_data->DirtyX1 = ImMax(dynamic_data->DirtyX1, rect_x + rect_w);
+        dynamic_data->DirtyY1 = ImMax(dynamic_data->DirtyY1, rect_y + rect_h);
+    }
+    dynamic_data->GlyphsRasterized++;
+    return &font->Glyphs.back();
+}
+
+// Double the texture height if a glyph didn't fit during the previous frame
+void ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicData* dynamic_data = atlas->DynamicData;
+    if (dynamic_data == NULL || !dynamic_data->GrowRequested)
+        return;
+    IM_ASSERT(!atlas->Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    dynamic_data->GrowRequested = false;
+
+    ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+    ImGui::SetMemTag(ImGuiMemTag_Font);
+    const int old_height = atlas->TexHeight;
+    const int new_height = old_height * 2;
+    const size_t old_pixels = (size_t)atlas->TexWidth * (size_t)old_height;
+    const size_t new_pixels = (size_t)atlas->TexWidth * (size_t)new_height;
+    unsigned char* pixels_alpha8 = (unsigned char*)IM_ALLOC(new_pixels);
+    memcpy(pixels_alpha8, atlas->TexPixelsAlpha8, old_pixels);
+    memset(pixels_alpha8 + old_pixels, 0, new_pixels - old_pixels);
+    IM_FREE(atlas->TexPixelsAlpha8);
+    atlas->TexPixelsAlpha8 = pixels_alpha8;
+    if (atlas->TexPixelsRGBA32)
+    {
+        unsigned int* pixels_rgba32 = (unsigned int*)IM_ALLOC(new_pixels * 4);
+        memcpy(pixels_rgba32, atlas->TexPixelsRGBA32, old_pixels * 4);
+        for (size_t n = old_pixels; n < new_pixels; n++)
+            pixels_rgba32[n] = IM_COL32(255, 255, 255, 0);
+        IM_FREE(atlas->TexPixelsRGBA32);
+        atlas->TexPixelsRGBA32 = pixels_rgba32;
+    }
+    ImGui::SetMemTag(backup_mem_tag);
+
+    // Pixels didn't move, rescale vertical texture coordinates (exact, the ratio is a power of two)
+    const float v_scale = (float)old_height / (float)new_height;
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImFont* font = atlas->Fonts[font_n];
+        for (int glyph_n = 0; glyph_n < font->Glyphs.Size; glyph_n++)
+        {
+            font->Glyphs[glyph_n].V0 *= v_scale;
+            font->Glyphs[glyph_n].V1 *= v_scale;
+        }
+    }
+    atlas->TexUvWhitePixel.y *= v_scale;
+    for (int n = 0; n < IM_ARRAYSIZE(atlas->TexUvLines); n++)
+    {
+        atlas->TexUvLines[n].y *= v_scale;
+        atlas->TexUvLines[n].w *= v_scale;
+    }
+    atlas->TexHeight = new_height;
+    atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
+    ((stbrp_context*)dynamic_data->PackContext.pack_info)->height = atlas->TexHeight - atlas->TexGlyphPadding;
+    dynamic_data->DirtyX0 = dynamic_data->DirtyY0 = 0;
+    dynamic_data->DirtyX1 = atlas->TexWidth;
+    dynamic_data->DirtyY1 = atlas->TexHeight;
+    atlas->BuildCount++;
+}
+
+void ImFontAtlasBuildDestroyDynamicData(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicData* dynamic_data = atlas->DynamicData;
+    if (dynamic_data == NULL)
+        return;
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+    {
+        ImFont* font = atlas->Fonts[font_n];
+        for (int codepoint = 0; codepoint < font->IndexLookup.Size; codepoint++)
+            if (font->IndexLookup[codepoint] == IM_FONTGLYPH_INDEX_PENDING)
+                ImFontAtlasBuildDynamicSetMissing(font, (ImWchar)codepoint);
+    }
+    if (dynamic_data->PackContext.pack_info != NULL)
+        stbtt_PackEnd(&dynamic_data->PackContext);
+    IM_DELETE(dynamic_data);
+    atlas->DynamicData = NULL;
+}
+
+bool ImFontAtlas::GetTexDataDirtyRect(int* out_x, int* out_y, int* out_w, int* out_h)
+{
+    ImFontAtlasDynamicData* dynamic_data = DynamicData;
+    if (dynamic_data == NULL || dynamic_data->DirtyX1 <= dynamic_data->DirtyX0)
+        return false;
+    if (out_x) *out_x = dynamic_data->DirtyX0;
+    if (out_y) *out_y = dynamic_data->DirtyY0;
+    if (out_w) *out_w = dynamic_data->DirtyX1 - dynamic_data->DirtyX0;
+    if (out_h) *out_h = dynamic_data->DirtyY1 - dynamic_data->DirtyY0;
+    dynamic_data->DirtyX0 = dynamic_data->DirtyY0 = dynamic_data->DirtyX1 = dynamic_data->DirtyY1 = 0;
+    return true;
+}
+
+#else
+
+// ImFontAtlasFlags_DynamicGlyphs requires the stb_truetype builder: DynamicData is never created
+void ImFontAtlasBuildDynamicMarkPending(ImFontAtlas*, ImFont*) {}
+const ImFontGlyph* ImFontAtlasBuildDynamicGlyph(ImFontAtlas*, ImFont*, ImWchar) { return NULL; }
+void ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas*) {}
+void ImFontAtlasBuildDestroyDynamicData(ImFontAtlas*) {}
+bool ImFontAtlas::GetTexDataDirtyRect(int*, int*, int*, int*) { return false; }
+
 #endif // IMGUI_ENABLE_STB_TRUETYPE
 
 void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
@@ -2772,6 +3529,8 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 // This is called/shared by both the stb_truetype and the FreeType builder.
 void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
 {
+    atlas->BuildCount++;
+
     // Render into our custom data blocks
     IM_ASSERT(atlas->TexPixelsAlpha8 != NULL || atlas->TexPixelsRGBA32 != NULL);
     ImFontAtlasBuildRenderDefaultTexData(atlas);
@@ -2849,6 +3608,238 @@ static void UnpackAccumulativeOffsetsIntoRanges(int base_codepoint, const short*
     out_ranges[0] = 0;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] ImFontAtlas build cache
+//-------------------------------------------------------------------------
+// The cache stores the output of Build() (Alpha8 pixels, glyphs, position of custom rectangles) after a key
+// made of everything Build() reads: font data (hashed), configs, glyph ranges, custom rectangles, atlas settings.
+// The key is compared byte for byte on load. The data is a memory dump: it is only valid for the same version of
+// Dear ImGui, compile-time options (e.g. IMGUI_USE_WCHAR32) and CPU endianness, which are part of the key too.
+//-------------------------------------------------------------------------
+
+#define IM_FONTATLAS_CACHE_VERSION  1
+
+static void ImFontAtlasCacheWrite(ImVector<unsigned char>* buf, const void* data, size_t size)
+{
+    const int offset = buf->Size;
+    buf->resize(offset + (int)size);
+    if (size > 0)
+        memcpy(buf->Data + offset, data, size);
+}
+
+static void ImFontAtlasCacheWriteInt(ImVector<unsigned char>* buf, int v)       { ImFontAtlasCacheWrite(buf, &v, sizeof(v)); }
+static void ImFontAtlasCacheWriteFloat(ImVector<unsigned char>* buf, float v)   { ImFontAtlasCacheWrite(buf, &v, sizeof(v)); }
+
+static bool ImFontAtlasCacheRead(const unsigned char** p, const unsigned char* p_end, void* out_data, size_t size)
+{
+    if ((size_t)(p_end - *p) < size)
+        return false;
+    memcpy(out_data, *p, size);
+    *p += size;
+    return true;
+}
+
+static int ImFontAtlasCacheFindFont(const ImFontAtlas* atlas, const ImFont* font)
+{
+    for (int i = 0; i < atlas->Fonts.Size; i++)
+        if (atlas->Fonts[i] == font)
+            return i;
+    return -1;
+}
+
+// Fields are written one by one: no struct padding, and no pointers.
+static void ImFontAtlasBuildCacheKey(ImFontAtlas* atlas, ImVector<unsigned char>* out_key)
+{
+#ifdef IMGUI_ENABLE_FREETYPE
+    const int default_builder = 1;
+#else
+    const int default_builder = 0;
+#endif
+    ImFontAtlasCacheWriteInt(out_key, IMGUI_VERSION_NUM);
+    ImFontAtlasCacheWriteInt(out_key, (int)sizeof(ImWchar));
+    ImFontAtlasCacheWriteInt(out_key, (int)sizeof(ImFontGlyph));
+    ImFontAtlasCacheWriteInt(out_key, atlas->FontBuilderIO ? 2 : default_builder);
+    ImFontAtlasCacheWriteInt(out_key, atlas->Flags);
+    ImFontAtlasCacheWriteInt(out_key, atlas->TexDesiredWidth);
+    ImFontAtlasCacheWriteInt(out_key, atlas->TexGlyphPadding);
+    ImFontAtlasCacheWriteInt(out_key, (int)atlas->FontBuilderFlags);
+    ImFontAtlasCacheWriteInt(out_key, atlas->SdfSpread);
+    ImFontAtlasCacheWriteInt(out_key, atlas->Fonts.Size);
+
+    ImFontAtlasCacheWriteInt(out_key, atlas->ConfigData.Size);
+    for (int i = 0; i < atlas->ConfigData.Size; i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[i];
+        ImFontAtlasCacheWriteInt(out_key, cfg.FontDataSize);
+        ImFontAtlasCacheWriteInt(out_key, (int)ImHashData(cfg.FontData, (size_t)cfg.FontDataSize));
+        ImFontAtlasCacheWriteInt(out_key, cfg.FontNo);
+        ImFontAtlasCacheWriteFloat(out_key, cfg.SizePixels);
+        ImFontAtlasCacheWriteInt(out_key, cfg.OversampleH);
+        ImFontAtlasCacheWriteInt(out_key, cfg.OversampleV);
+        ImFontAtlasCacheWriteInt(out_key, cfg.PixelSnapH ? 1 : 0);
+        ImFontAtlasCacheWriteFloat(out_key, cfg.GlyphExtraSpacing.x);
+        ImFontAtlasCacheWriteFloat(out_key, cfg.GlyphExtraSpacing.y);
+        ImFontAtlasCacheWriteFloat(out_key, cfg.GlyphOffset.x);
+        ImFontAtlasCacheWriteFloat(out_key, cfg.GlyphOffset.y);
+        ImFontAtlasCacheWriteFloat(out_key, cfg.GlyphMinAdvanceX);
+        ImFontAtlasCacheWriteFloat(out_key, cfg.GlyphMaxAdvanceX);
+        ImFontAtlasCacheWriteInt(out_key, cfg.MergeMode ? 1 : 0);
+        ImFontAtlasCacheWriteInt(out_key, (int)cfg.FontBuilderFlags);
+        ImFontAtlasCacheWriteFloat(out_key, cfg.RasterizerMultiply);
+        ImFontAtlasCacheWriteInt(out_key, (int)cfg.EllipsisChar);
+        ImFontAtlasCacheWriteInt(out_key, ImFontAtlasCacheFindFont(atlas, cfg.DstFont));
+        int ranges_count = 0;
+        if (cfg.GlyphRanges)
+            while (cfg.GlyphRanges[ranges_count])
+                ranges_count++;
+        ImFontAtlasCacheWriteInt(out_key, ranges_count);
+        ImFontAtlasCacheWrite(out_key, cfg.GlyphRanges, ranges_count * sizeof(ImWchar));
+    }
+
+    ImFontAtlasCacheWriteInt(out_key, atlas->CustomRects.Size);
+    for (int i = 0; i < atlas->CustomRects.Size; i++)
+    {
+        const ImFontAtlasCustomRect& r = atlas->CustomRects[i];
+        ImFontAtlasCacheWriteInt(out_key, r.Width);
+        ImFontAtlasCacheWriteInt(out_key, r.Height);
+        ImFontAtlasCacheWriteInt(out_key, (int)r.GlyphID);
+        ImFontAtlasCacheWriteFloat(out_key, r.GlyphAdvanceX);
+        ImFontAtlasCacheWriteFloat(out_key, r.GlyphOffset.x);
+        ImFontAtlasCacheWriteFloat(out_key, r.GlyphOffset.y);
+        ImFontAtlasCacheWriteInt(out_key, ImFontAtlasCacheFindFont(atlas, r.Font));
+    }
+}
+
+// Layout: "ImFA", version, key size, key, texture size, custom rects positions, per font: metrics + glyphs, then pixels.
+bool ImFontAtlas::SaveBuildCacheToMemory(ImVector<unsigned char>* out_data)
+{
+    IM_ASSERT(out_data != NULL);
+    if (TexPixelsAlpha8 == NULL || DynamicData != NULL || (Flags & ImFontAtlasFlags_DynamicGlyphs))
+        return false;
+
+    ImVector<unsigned char> key;
+    ImFontAtlasBuildCacheKey(this, &key);
+    out_data->resize(0);
+    ImFontAtlasCacheWrite(out_data, "ImFA", 4);
+    ImFontAtlasCacheWriteInt(out_data, IM_FONTATLAS_CACHE_VERSION);
+    ImFontAtlasCacheWriteInt(out_data, key.Size);
+    ImFontAtlasCacheWrite(out_data, key.Data, (size_t)key.Size);
+
+    ImFontAtlasCacheWriteInt(out_data, TexWidth);
+    ImFontAtlasCacheWriteInt(out_data, TexHeight);
+    for (int i = 0; i < CustomRects.Size; i++)
+    {
+        ImFontAtlasCacheWrite(out_data, &CustomRects[i].X, sizeof(CustomRects[i].X));
+        ImFontAtlasCacheWrite(out_data, &CustomRects[i].Y, sizeof(CustomRects[i].Y));
+    }
+    for (int i = 0; i < Fonts.Size; i++)
+    {
+        const ImFont* font = Fonts[i];
+        ImFontAtlasCacheWriteFloat(out_data, font->Ascent);
+        ImFontAtlasCacheWriteFloat(out_data, font->Descent);
+        ImFontAtlasCacheWriteInt(out_data, font->MetricsTotalSurface);
+        ImFontAtlasCacheWriteInt(out_data, font->Glyphs.Size);
+        ImFontAtlasCacheWrite(out_data, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+    }
+    ImFontAtlasCacheWrite(out_data, TexPixelsAlpha8, (size_t)TexWidth * TexHeight);
+    return true;
+}
+
+bool ImFontAtlas::LoadBuildCacheFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (Flags & ImFontAtlasFlags_DynamicGlyphs)
+        return false;
+
+    // Same as Build(): default font, then the custom rectangles for mouse cursors and lines, which are part of the key
+    if (ConfigData.Size == 0)
+        AddFontDefault();
+    ImFontAtlasBuildInit(this);
+
+    // Validate the whole cache before touching the output of a previous build
+    const unsigned char* p = (const unsigned char*)data;
+    const unsigned char* p_end = p + data_size;
+    char magic[4];
+    int version = 0, key_size = 0;
+    if (!ImFontAtlasCacheRead(&p, p_end, magic, 4) || memcmp(magic, "ImFA", 4) != 0)
+        return false;
+    if (!ImFontAtlasCacheRead(&p, p_end, &version, sizeof(int)) || version != IM_FONTATLAS_CACHE_VERSION)
+        return false;
+    ImVector<unsigned char> key;
+    ImFontAtlasBuildCacheKey(this, &key);
+    if (!ImFontAtlasCacheRead(&p, p_end, &key_size, sizeof(int)) || key_size != key.Size || (size_t)(p_end - p) < (size_t)key_size || memcmp(p, key.Data, (size_t)key_size) != 0)
+        return false;
+    p += key_size;
+
+    int tex_width = 0, tex_height = 0;
+    if (!ImFontAtlasCacheRead(&p, p_end, &tex_width, sizeof(int)) || !ImFontAtlasCacheRead(&p, p_end, &tex_height, sizeof(int)) || tex_width <= 0 || tex_height <= 0)
+        return false;
+    const unsigned char* rects_data = p;
+    const size_t rects_size = (size_t)CustomRects.Size * (sizeof(CustomRects[0].X) + sizeof(CustomRects[0].Y));
+    if ((size_t)(p_end - p) < rects_size)
+        return false;
+    p += rects_size;
+    const unsigned char* fonts_data = p;
+    for (int i = 0; i < Fonts.Size; i++)
+    {
+        float metrics[2];
+        int surface = 0, glyphs_count = 0;
+        if (!ImFontAtlasCacheRead(&p, p_end, metrics, sizeof(metrics)) || !ImFontAtlasCacheRead(&p, p_end, &surface, sizeof(int)) || !ImFontAtlasCacheRead(&p, p_end, &glyphs_count, sizeof(int)))
+            return false;
+        if (glyphs_count <= 0 || glyphs_count >= 0xFFFE || (size_t)(p_end - p) < glyphs_count * sizeof(ImFontGlyph))
+            return false;
+        p += glyphs_count * sizeof(ImFontGlyph);
+    }
+    if ((size_t)(p_end - p) != (size_t)tex_width * tex_height)
+        return false;
+
+    // Restore the output of Build()
+    ImGuiMemTag backup_mem_tag = ImGui::GetMemTag();
+    ImGui::SetMemTag(ImGuiMemTag_Font);
+    ClearTexData();
+    TexWidth = tex_width;
+    TexHeight = tex_height;
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    TexPixelsAlpha8 = (unsigned char*)IM_ALLOC((size_t)TexWidth * TexHeight);
+    memcpy(TexPixelsAlpha8, p, (size_t)TexWidth * TexHeight);
+
+    p = rects_data;
+    for (int i = 0; i < CustomRects.Size; i++)
+    {
+        ImFontAtlasCacheRead(&p, p_end, &CustomRects[i].X, sizeof(CustomRects[i].X));
+        ImFontAtlasCacheRead(&p, p_end, &CustomRects[i].Y, sizeof(CustomRects[i].Y));
+    }
+
+    // Glyphs include the custom rectangle glyphs and the tab glyph added by ImFontAtlasBuildFinish(),
+    // BuildLookupTable() reuses the tab glyph when it is last.
+    p = fonts_data;
+    for (int i = 0; i < Fonts.Size; i++)
+    {
+        ImFont* font = Fonts[i];
+        float metrics[2];
+        int surface, glyphs_count;
+        ImFontAtlasCacheRead(&p, p_end, metrics, sizeof(metrics));
+        ImFontAtlasCacheRead(&p, p_end, &surface, sizeof(int));
+        ImFontAtlasCacheRead(&p, p_end, &glyphs_count, sizeof(int));
+        for (int cfg_n = 0; cfg_n < ConfigData.Size; cfg_n++)
+            if (ConfigData[cfg_n].DstFont == font)
+                ImFontAtlasBuildSetupFont(this, font, &ConfigData[cfg_n], metrics[0], metrics[1]);
+        font->MetricsTotalSurface = surface;
+        font->Glyphs.resize(glyphs_count);
+        ImFontAtlasCacheRead(&p, p_end, font->Glyphs.Data, glyphs_count * sizeof(ImFontGlyph));
+    }
+
+    // Same as ImFontAtlasBuildFinish() minus the custom rectangle glyphs, already in the cache
+    BuildCount++;
+    ImFontAtlasBuildRenderDefaultTexData(this);
+    ImFontAtlasBuildRenderLinesTexData(this);
+    for (int i = 0; i < Fonts.Size; i++)
+        Fonts[i]->BuildLookupTable();
+    TexReady = true;
+    ImGui::SetMemTag(backup_mem_tag);
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] ImFontAtlas glyph ranges helpers
 //-------------------------------------------------------------------------
@@ -3132,10 +4123,11 @@ void    ImFont::ClearOutputData()
     MetricsTotalSurface = 0;
 }
 
+// Glyphs pending rasterization (ImFontAtlasFlags_DynamicGlyphs) exist too
 static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_chars, int candidate_chars_count)
 {
     for (int n = 0; n < candidate_chars_count; n++)
-        if (font->FindGlyphNoFallback(candidate_chars[n]) != NULL)
+        if (candidate_chars[n] < font->IndexLookup.Size && font->IndexLookup.Data[candidate_chars[n]] != (ImWchar)-1)
             return candidate_chars[n];
     return (ImWchar)-1;
 }
@@ -3147,7 +4139,7 @@ void ImFont::BuildLookupTable()
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
 
     // Build lookup table
-    IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
+    IM_ASSERT(Glyphs.Size < 0xFFFE); // -1 and -2 (IM_FONTGLYPH_INDEX_PENDING) are reserved
     IndexAdvanceX.clear();
     IndexLookup.clear();
     DirtyLookupTables = false;
@@ -3163,6 +4155,8 @@ void ImFont::BuildLookupTable()
         const int page_n = codepoint / 4096;
         Used4kPagesMap[page_n >> 3] |= 1 << (page_n & 7);
     }
+    if (ContainerAtlas && ContainerAtlas->DynamicData)
+        ImFontAtlasBuildDynamicMarkPending(ContainerAtlas, this);
 
     // Create a glyph to handle TAB
     // FIXME: Needs proper TAB handling but it needs to be contextualized (or we could arbitrary say that each string starts at "column 0" ?)
@@ -3194,11 +4188,11 @@ void ImFont::BuildLookupTable()
 
     // Setup fallback character
     const ImWchar fallback_chars[] = { (ImWchar)IM_UNICODE_CODEPOINT_INVALID, (ImWchar)'?', (ImWchar)' ' };
-    FallbackGlyph = FindGlyphNoFallback(FallbackChar);
+    FallbackGlyph = LoadGlyphNoFallback(FallbackChar);
     if (FallbackGlyph == NULL)
     {
         FallbackChar = FindFirstExistingGlyph(this, fallback_chars, IM_ARRAYSIZE(fallback_chars));
-        FallbackGlyph = FindGlyphNoFallback(FallbackChar);
+        FallbackGlyph = LoadGlyphNoFallback(FallbackChar);
         if (FallbackGlyph == NULL)
         {
             FallbackGlyph = &Glyphs.back();
@@ -3207,7 +4201,7 @@ void ImFont::BuildLookupTable()
     }
 
     FallbackAdvanceX = FallbackGlyph->AdvanceX;
-    for (int i = 0; i < max_codepoint + 1; i++)
+    for (int i = 0; i < IndexAdvanceX.Size; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
 }
@@ -3291,6 +4285,8 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
     unsigned int index_size = (unsigned int)IndexLookup.Size;
+    if (src < index_size && IndexLookup.Data[src] == IM_FONTGLYPH_INDEX_PENDING)
+        LoadGlyphNoFallback(src);       // Rasterize now, 'dst' would be looked up in the source fonts
 
     if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
         return;
@@ -3307,7 +4303,7 @@ const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
     if (c >= (size_t)IndexLookup.Size)
         return FallbackGlyph;
     const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    if (i >= IM_FONTGLYPH_INDEX_PENDING)
         return FallbackGlyph;
     return &Glyphs.Data[i];
 }
@@ -3317,11 +4313,27 @@ const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
     if (c >= (size_t)IndexLookup.Size)
         return NULL;
     const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    if (i >= IM_FONTGLYPH_INDEX_PENDING)
         return NULL;
     return &Glyphs.Data[i];
 }
 
+const ImFontGlyph* ImFont::LoadGlyph(ImWchar c)
+{
+    const ImFontGlyph* glyph = LoadGlyphNoFallback(c);
+    return glyph ? glyph : FallbackGlyph;
+}
+
+const ImFontGlyph* ImFont::LoadGlyphNoFallback(ImWchar c)
+{
+    if (c >= (size_t)IndexLookup.Size)
+        return NULL;
+    const ImWchar i = IndexLookup.Data[c];
+    if (i >= IM_FONTGLYPH_INDEX_PENDING)
+        return (i == IM_FONTGLYPH_INDEX_PENDING) ? ImFontAtlasBuildDynamicGlyph(ContainerAtlas, this, c) : NULL;
+    return &Glyphs.Data[i];
+}
+
 const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const
 {
     // Simple word-wrapping for English, not full-featured. Please submit failing cases!
@@ -3421,6 +4433,34 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     return s;
 }
 
+#ifdef IMGUI_ENABLE_SSE
+// Sum of IndexAdvanceX[] * scale for 'count' (multiple of 4) ASCII characters, 4 at a time.
+// The additions are not done in the same order as the scalar loop of CalcTextSizeA(), which only makes a difference
+// when advances * scale are not exactly representable sums (integer advances of the default font are always exact).
+static inline float ImFontSumAdvanceXAscii(const float* advance_x, float scale, const unsigned char* s, int count)
+{
+    const __m128 scale4 = _mm_set1_ps(scale);
+    __m128 sum = _mm_setzero_ps();
+    for (int n = 0; n < count; n += 4)
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_set_ps(advance_x[s[n + 3]], advance_x[s[n + 2]], advance_x[s[n + 1]], advance_x[s[n]]), scale4));
+    sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+    sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(sum);
+}
+
+static inline int ImCountTrailingZeros(unsigned int mask)
+{
+    IM_ASSERT(mask != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(mask);
+#else
+    int n = 0;
+    while ((mask & 1) == 0) { mask >>= 1; n++; }
+    return n;
+#endif
+}
+#endif
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining) const
 {
     if (!text_end)
@@ -3434,10 +4474,44 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
 
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
+#ifdef IMGUI_ENABLE_SSE
+    const bool ascii_fast_path = !word_wrap_enabled && IndexAdvanceX.Size >= 0x80;
+    const char* ascii_fast_path_resume = text_begin; // Characters before this are left to the scalar path
+    const __m128i newline16 = _mm_set1_epi8('\n');
+    const __m128i return16 = _mm_set1_epi8('\r');
+#endif
 
     const char* s = text_begin;
     while (s < text_end)
     {
+#ifdef IMGUI_ENABLE_SSE
+        // Fast path for unwrapped text (e.g. long log lines): look at 16 bytes at once and measure the leading run of
+        // ASCII characters other than '\n' and '\r', which need neither UTF-8 decoding nor any per-character check.
+        if (ascii_fast_path && s >= ascii_fast_path_resume && s + 16 <= text_end)
+        {
+            const __m128i chars = _mm_loadu_si128((const __m128i*)(const void*)s);
+            const __m128i special = _mm_or_si128(_mm_cmpeq_epi8(chars, newline16), _mm_cmpeq_epi8(chars, return16));
+            const unsigned int special_mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(chars, special)); // High bit set for non-ASCII bytes, '\n' and '\r'
+            const int special_pos = special_mask ? ImCountTrailingZeros(special_mask) : 16;
+            const int run_len = special_pos & ~3;
+            if (run_len > 0)
+            {
+                const float run_width = ImFontSumAdvanceXAscii(IndexAdvanceX.Data, scale, (const unsigned char*)s, run_len);
+                if (line_width + run_width < max_width)
+                {
+                    line_width += run_width;
+                    s += run_len;
+                    continue;
+                }
+                ascii_fast_path_resume = s + run_len; // Let the scalar path find which character reaches max_width
+            }
+            else
+            {
+                ascii_fast_path_resume = s + special_pos + 1; // Less than 4 characters before a special one: don't retry until past it
+            }
+        }
+#endif
+
         if (word_wrap_enabled)
         {
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
@@ -3515,10 +4589,97 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     return text_size;
 }
 
+// Same layout as ImFont::CalcTextSizeA() with no max width, also storing the offset of the first character of each line.
+// Rendering from one of those offsets gives the same line breaks as rendering from the beginning of the text: ImGui::TextEx()
+// uses them to only render the visible lines of long wrapped text (see ImGuiTextWrapCache).
+ImVec2 ImFontCalcTextLineStarts(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end, ImVector<int>* out_line_starts)
+{
+    const float line_height = size;
+    const float scale = size / font->FontSize;
+
+    ImVec2 text_size = ImVec2(0, 0);
+    float line_width = 0.0f;
+
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    const char* word_wrap_eol = NULL;
+
+    out_line_starts->resize(0);
+    out_line_starts->push_back(0);
+    const char* s = text_begin;
+    while (s < text_end)
+    {
+        if (word_wrap_enabled)
+        {
+            if (!word_wrap_eol)
+            {
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
+                if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
+                    word_wrap_eol++;
+            }
+
+            if (s >= word_wrap_eol)
+            {
+                if (text_size.x < line_width)
+                    text_size.x = line_width;
+                text_size.y += line_height;
+                line_width = 0.0f;
+                word_wrap_eol = NULL;
+
+                // Wrapping skips upcoming blanks
+                while (s < text_end)
+                {
+                    const char c = *s;
+                    if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+                }
+                out_line_starts->push_back((int)(s - text_begin));
+                continue;
+            }
+        }
+
+        // Decode and advance source
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+        {
+            s += 1;
+        }
+        else
+        {
+            s += ImTextCharFromUtf8(&c, s, text_end);
+            if (c == 0) // Malformed UTF-8?
+                break;
+        }
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                text_size.x = ImMax(text_size.x, line_width);
+                text_size.y += line_height;
+                line_width = 0.0f;
+                out_line_starts->push_back((int)(s - text_begin));
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        line_width += ((int)c < font->IndexAdvanceX.Size ? font->IndexAdvanceX.Data[c] : font->FallbackAdvanceX) * scale;
+    }
+
+    if (text_size.x < line_width)
+        text_size.x = line_width;
+
+    if (line_width > 0 || text_size.y == 0.0f)
+        text_size.y += line_height;
+
+    return text_size;
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
+// Rendering rasterizes pending glyphs (ImFontAtlasFlags_DynamicGlyphs): fonts are owned by their atlas, LoadGlyph() changes them.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, ImWchar c) const
 {
-    const ImFontGlyph* glyph = FindGlyph(c);
+    const ImFontGlyph* glyph = ((ImFont*)this)->LoadGlyph(c);
     if (!glyph || !glyph->Visible)
         return;
     if (glyph->Colored)
@@ -3530,6 +4691,87 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     draw_list->PrimRectUV(ImVec2(pos.x + glyph->X0 * scale, pos.y + glyph->Y0 * scale), ImVec2(pos.x + glyph->X1 * scale, pos.y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
 }
 
+// Render text from the quads stored in the text layout cache (see io.ConfigTextLayoutCache). Return false to let the caller render it.
+// Quads are only replayed if RenderText() wouldn't skip, cull or clip any of them, so the output is the same save for the last bits of
+// vertex positions with fractional glyph advances (the position is added after the advances instead of before).
+static bool ImFontRenderTextFromCache(const ImFont* font, ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTextLayoutCache& cache = g.TextLayoutCache;
+    ImGuiTextLayoutEntry* layout = cache.GetEntry(font, size, wrap_width, text_begin, text_end);
+    if (!layout->HasQuads)
+    {
+        // Store quads the second frame the text is seen, so text changing every frame doesn't pay for it
+        if (layout->CreatedFrame == g.FrameCount)
+        {
+            cache.Stats.QuadsMisses++;
+            return false;
+        }
+        if (!layout->HasSize)
+        {
+            layout->Size = font->CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end);
+            layout->HasSize = true;
+        }
+
+        // Render at (0,0) with no clipping and a zero color, which leaves ~IM_COL32_A_MASK in the color of untinted glyphs
+        if (cache.ScratchDrawList == NULL)
+            cache.ScratchDrawList = IM_NEW(ImDrawList)(&g.DrawListSharedData);
+        ImDrawList* scratch = cache.ScratchDrawList;
+        scratch->_ResetForNewFrame();
+        cache.Storing = true;
+        font->RenderText(scratch, size, ImVec2(0.0f, 0.0f), 0, ImVec4(-FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX), text_begin, text_end, wrap_width, false);
+        cache.Storing = false;
+
+        layout->Quads.resize(scratch->VtxBuffer.Size);
+        if (scratch->VtxBuffer.Size > 0)
+            memcpy(layout->Quads.Data, scratch->VtxBuffer.Data, (size_t)layout->Quads.size_in_bytes());
+        layout->QuadsMin = ImVec2(0.0f, 0.0f);
+        layout->QuadsMax = ImVec2(0.0f, 0.0f);
+        for (int n = 0; n < layout->Quads.Size; n++)
+        {
+            layout->QuadsMin = ImMin(layout->QuadsMin, layout->Quads.Data[n].pos);
+            layout->QuadsMax = ImMax(layout->QuadsMax, layout->Quads.Data[n].pos);
+        }
+        layout->HasQuads = true;
+    }
+
+    // Same conditions as RenderText(): no line skipped before clip_rect.y, no line past clip_rect.w, no glyph culled or clipped.
+    const float line_height = font->FontSize * (size / font->FontSize);
+    if (pos.y + line_height < clip_rect.y || pos.y + layout->Size.y - line_height > clip_rect.w ||
+        pos.x + layout->QuadsMin.x < clip_rect.x || pos.y + layout->QuadsMin.y < clip_rect.y ||
+        pos.x + layout->QuadsMax.x > clip_rect.z || pos.y + layout->QuadsMax.y > clip_rect.w)
+    {
+        cache.Stats.QuadsMisses++;
+        return false;
+    }
+    cache.Stats.QuadsHits++;
+
+    const int vtx_count = layout->Quads.Size;
+    if (vtx_count == 0)
+        return true;
+    draw_list->PrimReserve((vtx_count / 4) * 6, vtx_count);
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+    const ImDrawVert* src = layout->Quads.Data;
+    for (int n = 0; n < vtx_count; n += 4, src += 4)
+    {
+        idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
+        idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
+        vtx_write[0].pos.x = src[0].pos.x + pos.x; vtx_write[0].pos.y = src[0].pos.y + pos.y; vtx_write[0].col = src[0].col | col; vtx_write[0].uv = src[0].uv;
+        vtx_write[1].pos.x = src[1].pos.x + pos.x; vtx_write[1].pos.y = src[1].pos.y + pos.y; vtx_write[1].col = src[1].col | col; vtx_write[1].uv = src[1].uv;
+        vtx_write[2].pos.x = src[2].pos.x + pos.x; vtx_write[2].pos.y = src[2].pos.y + pos.y; vtx_write[2].col = src[2].col | col; vtx_write[2].uv = src[2].uv;
+        vtx_write[3].pos.x = src[3].pos.x + pos.x; vtx_write[3].pos.y = src[3].pos.y + pos.y; vtx_write[3].col = src[3].col | col; vtx_write[3].uv = src[3].uv;
+        vtx_write += 4;
+        vtx_current_idx += 4;
+        idx_write += 6;
+    }
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_current_idx;
+    return true;
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
 {
@@ -3544,6 +4786,16 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     if (y > clip_rect.w)
         return;
 
+    // Text layout cache. Not for draw lists setup with PrepareDrawList(), which may be recorded from other threads.
+    ImGuiContext* ctx = GImGui;
+    if (ctx != NULL && draw_list->_Data == &ctx->DrawListSharedData && ctx->IO.ConfigTextLayoutCache && !ctx->TextLayoutCache.Storing)
+    {
+        const int text_len = (int)(text_end - text_begin);
+        if (text_len >= IM_TEXT_LAYOUT_CACHE_MIN_LEN && text_len <= IM_TEXT_LAYOUT_CACHE_MAX_LEN)
+            if (ImFontRenderTextFromCache(this, draw_list, size, pos, col, clip_rect, text_begin, text_end, wrap_width))
+                return;
+    }
+
     const float scale = size / FontSize;
     const float line_height = FontSize * scale;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
@@ -3643,7 +4895,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                 continue;
         }
 
-        const ImFontGlyph* glyph = FindGlyph((ImWchar)c);
+        const ImFontGlyph* glyph = ((ImFont*)this)->LoadGlyph((ImWchar)c);  // Rasterize pending glyphs, see RenderChar()
         if (glyph == NULL)
             continue;
 
@@ -58,6 +58,11 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+// Atomic intrinsics (ImAtomicXXX helpers)
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -137,6 +142,7 @@ struct ImGuiTableColumn;            // Storage for one column of a table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiTableDataSourceSortJob; // Sort of a table data source running in the background (io.BackgroundJobFn)
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
@@ -271,6 +277,7 @@ namespace ImStb
 // - Helpers: Hashing
 // - Helpers: Sorting
 // - Helpers: Bit manipulation
+// - Helpers: Atomics
 // - Helpers: String, Formatting
 // - Helpers: UTF-8 <> wchar conversions
 // - Helpers: ImVec2/ImVec4 operators
@@ -304,6 +311,37 @@ static inline bool      ImIsPowerOfTwo(int v)           { return v != 0 && (v &
 static inline bool      ImIsPowerOfTwo(ImU64 v)         { return v != 0 && (v & (v - 1)) == 0; }
 static inline int       ImUpperPowerOfTwo(int v)        { v--; v |= v >> 1; v |= v >> 2; v |= v >> 4; v |= v >> 8; v |= v >> 16; v++; return v; }
 
+// Helpers: Atomics
+// For values shared with other threads: allocation counters (relaxed ordering: they are only statistics), background jobs completion.
+// ImAtomicAdd() returns the new value. ImAtomicMax() raises *p to v. ImAtomicStore() publishes the writes made before it to the
+// thread seeing the value with ImAtomicLoad(), e.g. a job storing its 'Done' flag after writing its results.
+#if defined(_MSC_VER) && !defined(__clang__)
+static inline int       ImAtomicAdd(int* p, int v)              { return (int)_InterlockedExchangeAdd((volatile long*)p, (long)v) + v; }
+static inline int       ImAtomicExchange(int* p, int v)         { return (int)_InterlockedExchange((volatile long*)p, (long)v); }
+static inline void      ImAtomicStore(int* p, int v)            { _InterlockedExchange((volatile long*)p, (long)v); }
+static inline int       ImAtomicLoad(const int* p)              { return (int)_InterlockedCompareExchange((volatile long*)p, 0, 0); }
+#ifdef _WIN64
+static inline size_t    ImAtomicAdd(size_t* p, size_t v)        { return (size_t)_InterlockedExchangeAdd64((volatile __int64*)p, (__int64)v) + v; }
+static inline size_t    ImAtomicExchange(size_t* p, size_t v)   { return (size_t)_InterlockedExchange64((volatile __int64*)p, (__int64)v); }
+static inline size_t    ImAtomicLoad(const size_t* p)           { return (size_t)_InterlockedCompareExchange64((volatile __int64*)p, 0, 0); }
+static inline void      ImAtomicMax(size_t* p, size_t v)        { for (size_t old = ImAtomicLoad(p); old < v; old = ImAtomicLoad(p)) if ((size_t)_InterlockedCompareExchange64((volatile __int64*)p, (__int64)v, (__int64)old) == old) break; }
+#else
+static inline size_t    ImAtomicAdd(size_t* p, size_t v)        { return (size_t)_InterlockedExchangeAdd((volatile long*)p, (long)v) + v; }
+static inline size_t    ImAtomicExchange(size_t* p, size_t v)   { return (size_t)_InterlockedExchange((volatile long*)p, (long)v); }
+static inline size_t    ImAtomicLoad(const size_t* p)           { return (size_t)_InterlockedCompareExchange((volatile long*)p, 0, 0); }
+static inline void      ImAtomicMax(size_t* p, size_t v)        { for (size_t old = ImAtomicLoad(p); old < v; old = ImAtomicLoad(p)) if ((size_t)_InterlockedCompareExchange((volatile long*)p, (long)v, (long)old) == old) break; }
+#endif
+#else
+static inline int       ImAtomicAdd(int* p, int v)              { return __atomic_add_fetch(p, v, __ATOMIC_RELAXED); }
+static inline size_t    ImAtomicAdd(size_t* p, size_t v)        { return __atomic_add_fetch(p, v, __ATOMIC_RELAXED); }
+static inline int       ImAtomicExchange(int* p, int v)         { return __atomic_exchange_n(p, v, __ATOMIC_RELAXED); }
+static inline size_t    ImAtomicExchange(size_t* p, size_t v)   { return __atomic_exchange_n(p, v, __ATOMIC_RELAXED); }
+static inline void      ImAtomicStore(int* p, int v)            { __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static inline int       ImAtomicLoad(const int* p)              { return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline size_t    ImAtomicLoad(const size_t* p)           { return __atomic_load_n(p, __ATOMIC_RELAXED); }
+static inline void      ImAtomicMax(size_t* p, size_t v)        { size_t old = __atomic_load_n(p, __ATOMIC_RELAXED); while (old < v && !__atomic_compare_exchange_n(p, &old, v, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {} }
+#endif
+
 // Helpers: String, Formatting
 IMGUI_API int           ImStricmp(const char* str1, const char* str2);
 IMGUI_API int           ImStrnicmp(const char* str1, const char* str2, size_t count);
@@ -665,6 +703,159 @@ struct IMGUI_API ImChunkStream
 
 };
 
+// Helper: ImGuiFrameArena
+// Linear allocator for transient data which never outlives the current frame, see ImGui::MemAllocFrame(). Not thread-safe.
+// Memory is kept between frames: when a frame overflows the main block, the next Reset() replaces all blocks with a single larger one,
+// so once the arena has grown to the working set of a frame, subsequent frames don't call MemAlloc() at all.
+// The main block is shrunk back when it has been mostly unused for a while (e.g. after pasting a large clipboard once).
+struct IMGUI_API ImGuiFrameArena
+{
+    ImVector<char*>     Blocks;             // Blocks[0] is the main block, others were allocated when overflowing during the current frame
+    int                 BlockSize;          // Size of Blocks[0]
+    int                 CurrBlockSize;      // Size of Blocks.back()
+    int                 CurrBlockUsed;      // Bytes used in Blocks.back()
+    int                 FrameUsed;          // Bytes allocated during the current frame
+    int                 LastFrameUsed;      // Bytes allocated during the previous frame
+    int                 RecentPeak;         // Max of FrameUsed since the last shrink check
+    int                 RecentFrames;       // Number of frames since the last shrink check
+    int                 HighWater;          // Max of FrameUsed since creation
+
+    ImGuiFrameArena()   { BlockSize = CurrBlockSize = CurrBlockUsed = FrameUsed = LastFrameUsed = RecentPeak = RecentFrames = HighWater = 0; }
+    ~ImGuiFrameArena()  { Clear(); }
+    void*               Alloc(size_t size);
+    void                Reset();            // Start a new frame: all previous allocations are released
+    void                Clear();            // Release all memory
+};
+
+// Helper: ImGuiTextLayoutCache
+// Size and glyph quads of recently used text, for ImGui::CalcTextSize() and ImFont::RenderText(). Enabled by io.ConfigTextLayoutCache.
+// - Keyed by (font, size, wrap width, text address, text length), the text contents are compared on lookup. Hashing the contents would cost as much as measuring them.
+// - 4-way set associative with LRU replacement within each set: bounded memory and no lookup structure to maintain.
+// - Quads are only stored the second frame some text is seen, and only replayed when ImFont::RenderText() wouldn't clip any of them.
+#define IM_TEXT_LAYOUT_CACHE_SETS       256
+#define IM_TEXT_LAYOUT_CACHE_WAYS       4
+#define IM_TEXT_LAYOUT_CACHE_MIN_LEN    8       // Shorter text is about as fast to measure/render as to look up
+#define IM_TEXT_LAYOUT_CACHE_MAX_LEN    1024
+
+struct ImGuiTextLayoutEntry
+{
+    ImGuiID                 Key;            // 0 = unused
+    const char*             TextPtr;
+    ImVector<char>          Text;           // Copy of the text, compared on lookup
+    const ImFont*           Font;
+    float                   FontSize;
+    float                   WrapWidth;
+    int                     CreatedFrame;
+    ImU64                   LastUsed;       // ImGuiTextLayoutCache::Tick of the last lookup
+    bool                    HasSize;
+    bool                    HasQuads;
+    ImVec2                  Size;           // ImFont::CalcTextSizeA() result with no max width (not rounded)
+    ImVec2                  QuadsMin;       // Bounding box of Quads
+    ImVec2                  QuadsMax;
+    ImVector<ImDrawVert>    Quads;          // 4 vertices per glyph relative to the text position. 'col' is OR-ed with the text color: 0, or ~IM_COL32_A_MASK for colored glyphs.
+};
+
+struct ImGuiTextLayoutCacheStats
+{
+    int                     SizeHits;
+    int                     SizeMisses;
+    int                     QuadsHits;
+    int                     QuadsMisses;    // Including text rendered the regular way because it would be clipped
+    int                     Evictions;
+    ImGuiTextLayoutCacheStats() { memset(this, 0, sizeof(*this)); }
+};
+
+struct IMGUI_API ImGuiTextLayoutCache
+{
+    ImVector<ImGuiTextLayoutEntry> Entries; // IM_TEXT_LAYOUT_CACHE_SETS * IM_TEXT_LAYOUT_CACHE_WAYS, allocated on first use
+    ImU64                   Tick;
+    int                     FontAtlasBuildCount;
+    ImDrawList*             ScratchDrawList; // Used to render the quads of an entry
+    bool                    Storing;        // Set while rendering into ScratchDrawList
+    ImGuiTextLayoutCacheStats Stats;        // Current frame
+    ImGuiTextLayoutCacheStats StatsLastFrame;
+
+    ImGuiTextLayoutCache()  { Tick = 0; FontAtlasBuildCount = 0; ScratchDrawList = NULL; Storing = false; }
+    ImGuiTextLayoutEntry*   GetEntry(const ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end); // Find, or replace the least recently used entry of the set
+    void                    NewFrame(bool enabled, const ImFontAtlas* atlas);
+    void                    Clear();
+};
+
+// Helper: ImGuiTextWrapCache
+// Line breaks of long wrapped text, so ImGui::TextEx() only lays out and renders the visible lines of e.g. a multi-megabyte document. Enabled by io.ConfigTextLayoutCache.
+// - Keyed by (text address, font, size, wrap width): the same text shown at two wrap widths in a frame gets two entries. The text contents are compared on lookup, which is much cheaper than wrapping them.
+// - New contents lay out the text again in the same entry. A new font, size or wrap width reuses an entry of the same text which wasn't used during the frame, so resizing a window doesn't pile up copies.
+// - Entries not used for IM_TEXT_WRAP_CACHE_KEEP_FRAMES frames are released.
+#define IM_TEXT_WRAP_CACHE_MIN_LEN      2000    // Same threshold as the coarse clipping of long unwrapped text in TextEx()
+#define IM_TEXT_WRAP_CACHE_KEEP_FRAMES  60
+
+struct ImGuiTextWrapEntry
+{
+    const char*             TextPtr;
+    ImVector<char>          Text;           // Copy of the text, compared on lookup
+    const ImFont*           Font;
+    float                   FontSize;
+    float                   WrapWidth;
+    int                     LastUsedFrame;
+    ImVec2                  Size;           // ImFont::CalcTextSizeA() result (not rounded)
+    ImVector<int>           LineStarts;     // Offset of the first character of each line
+};
+
+struct IMGUI_API ImGuiTextWrapCache
+{
+    ImVector<ImGuiTextWrapEntry> Entries;
+    int                     FontAtlasBuildCount;
+    int                     Layouts;        // Texts laid out (cache misses) during the current frame
+    int                     LayoutsLastFrame;
+
+    ImGuiTextWrapCache()    { FontAtlasBuildCount = 0; Layouts = LayoutsLastFrame = 0; }
+    ImGuiTextWrapEntry*     GetEntry(const ImFont* font, float font_size, float wrap_width, const char* text, const char* text_end); // Find, or lay out the text
+    void                    NewFrame(bool enabled, const ImFontAtlas* atlas);
+    void                    Clear();
+};
+
+// Helper: ImGuiAllocTracker
+// Allocator functions wrapper counting allocations per subsystem tag (see ImGuiMemTag), viewable in the Metrics window.
+// - Install with ImGui::InstallAllocTracker() BEFORE creating any context, as it stores a small header in front of every block.
+// - Each block records the tag which was current on the allocating thread, so frees are attributed to the same tag.
+// - Tags are per thread and counters are updated atomically: other threads may allocate too (PrepareDrawList(), ImFontAtlas::BuildParallelFor()).
+enum ImGuiMemTag    // Subsystem which allocated a block, set on the current thread around allocating code with SetMemTag()
+{
+    ImGuiMemTag_Misc = 0,
+    ImGuiMemTag_DrawList,
+    ImGuiMemTag_Font,
+    ImGuiMemTag_Table,
+    ImGuiMemTag_TextBuffer,
+    ImGuiMemTag_Settings,
+    ImGuiMemTag_Window,
+    ImGuiMemTag_COUNT
+};
+
+struct ImGuiMemTagStats
+{
+    int                 ActiveCount;            // Number of live allocations
+    size_t              ActiveBytes;            // Size of live allocations
+    size_t              HighWaterBytes;         // Max of ActiveBytes
+    int                 FrameAllocCount;        // Allocations during the current frame
+    int                 FrameFreeCount;         // Frees during the current frame
+    size_t              FrameAllocBytes;        // Size allocated during the current frame
+    int                 LastFrameAllocCount;    // Same as above for the previous frame
+    int                 LastFrameFreeCount;
+    size_t              LastFrameAllocBytes;
+};
+
+struct IMGUI_API ImGuiAllocTracker
+{
+    ImGuiMemAllocFunc   ChainAllocFunc;         // Allocator functions which were installed before the tracker
+    ImGuiMemFreeFunc    ChainFreeFunc;
+    void*               ChainUserData;
+    ImGuiMemTagStats    Tags[ImGuiMemTag_COUNT];
+    ImGuiMemTagStats    Total;
+
+    ImGuiAllocTracker() { memset(this, 0, sizeof(*this)); }
+    void                NewFrame();             // Called by ImGui::NewFrame(): rotate per-frame counters
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -1064,7 +1255,8 @@ enum ImGuiNextWindowDataFlags_
     ImGuiNextWindowDataFlags_HasSizeConstraint  = 1 << 4,
     ImGuiNextWindowDataFlags_HasFocus           = 1 << 5,
     ImGuiNextWindowDataFlags_HasBgAlpha         = 1 << 6,
-    ImGuiNextWindowDataFlags_HasScroll          = 1 << 7
+    ImGuiNextWindowDataFlags_HasScroll          = 1 << 7,
+    ImGuiNextWindowDataFlags_Dirty              = 1 << 8    // Set by SetNextWindowDirty()
 };
 
 // Storage for SetNexWindow** functions
@@ -1490,6 +1682,8 @@ struct ImGuiContext
     ImGuiWindow*            WheelingWindow;                     // Track the window we started mouse-wheeling on. Until a timer elapse or mouse has moved, generally keep scrolling the same window even if during the course of scrolling the mouse ends up hovering a child window.
     ImVec2                  WheelingWindowRefMousePos;
     float                   WheelingWindowTimer;
+    ImGuiStyle              DrawListCacheStyle;                 // Copy of the style last seen by windows using ImGuiWindowFlags_CacheDrawList (byte copy, compared with memcmp), so their keys only store a version.
+    int                     DrawListCacheStyleVersion;          // Incremented when the style differs from DrawListCacheStyle
 
     // Item/widgets state and tracking information
     ImGuiID                 DebugHookIdInfo;                    // Will call core hooks: DebugHookIdInfo() from GetID functions, used by Stack Tool [next HoveredId/ActiveId to not pull in an extra cache-line]
@@ -1709,6 +1903,15 @@ struct ImGuiContext
     int                     WantTextInputNextFrame;
     char                    TempBuffer[1024 * 3 + 1];           // Temporary text buffer
 
+    // Memory
+    ImGuiFrameArena         FrameArena;                         // Transient allocations which never outlive the current frame, see MemAllocFrame()
+    ImGuiTextLayoutCache    TextLayoutCache;                    // See io.ConfigTextLayoutCache
+    ImGuiTextWrapCache      TextWrapCache;                      // See io.ConfigTextLayoutCache
+    int                     MemAllocCount;                      // Number of MemAlloc() calls during the current frame
+    int                     MemFreeCount;                       // Number of MemFree() calls during the current frame
+    int                     MemAllocCountLastFrame;             // (Metrics) MemAllocCount of the previous frame
+    int                     MemFreeCountLastFrame;              // (Metrics) MemFreeCount of the previous frame
+
     ImGuiContext(ImFontAtlas* shared_font_atlas)
     {
         Initialized = false;
@@ -1731,6 +1934,7 @@ struct ImGuiContext
         MovingWindow = NULL;
         WheelingWindow = NULL;
         WheelingWindowTimer = 0.0f;
+        DrawListCacheStyleVersion = 0;
 
         DebugHookIdInfo = 0;
         HoveredId = HoveredIdPreviousFrame = 0;
@@ -1857,6 +2061,8 @@ struct ImGuiContext
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
         memset(TempBuffer, 0, sizeof(TempBuffer));
+
+        MemAllocCount = MemFreeCount = MemAllocCountLastFrame = MemFreeCountLastFrame = 0;
     }
 };
 
@@ -1898,6 +2104,7 @@ struct IMGUI_API ImGuiWindowTempData
     int                     TreeDepth;              // Current tree depth.
     ImU32                   TreeJumpToParentOnPopMask; // Store a copy of !g.NavIdIsAlive for TreeDepth 0..31.. Could be turned into a ImU64 if necessary.
     ImVector<ImGuiWindow*>  ChildWindows;
+    ImVector<ImDrawList*>   SubmittedDrawLists;     // Draw lists recorded outside of the window (possibly on other threads) and passed to SubmitDrawList(). Rendered after DrawList, in submission order.
     ImGuiStorage*           StateStorage;           // Current persistent per-window storage (store e.g. tree node open/close state)
     ImGuiOldColumns*        CurrentColumns;         // Current columns set
     int                     CurrentTableIdx;        // Current table index (into g.Tables)
@@ -1913,6 +2120,29 @@ struct IMGUI_API ImGuiWindowTempData
     ImVector<float>         TextWrapPosStack;       // Store text wrap pos to restore (attention: .back() is not == TextWrapPos)
 };
 
+// State affecting the output of a window using ImGuiWindowFlags_CacheDrawList, besides its title. Compared with memcmp().
+struct ImGuiWindowDrawListCacheKey
+{
+    ImVec2                  Pos;
+    ImVec2                  Size;
+    ImVec2                  Scroll;
+    ImRect                  InnerClipRect;
+    ImVec2                  DisplaySize;
+    float                   FontSize;
+    float                   DimBgRatio;
+    float                   BgAlpha;                // -1.0f unless SetNextWindowBgAlpha() was used
+    ImU32                   ResizeGripCol[4];
+    ImGuiWindowFlags        Flags;
+    int                     StyleVersion;           // See ImGuiContext::DrawListCacheStyle
+    int                     FontAtlasBuildCount;
+    ImFont*                 Font;
+    bool                    TitleBarIsHighlight;
+    bool                    HasCloseButton;
+    signed char             ResizeBorderHeld;
+
+    ImGuiWindowDrawListCacheKey() { memset(this, 0, sizeof(*this)); }
+};
+
 // Storage for one window
 struct IMGUI_API ImGuiWindow
 {
@@ -1993,6 +2223,14 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImDrawList              DrawListCache;                      // With ImGuiWindowFlags_CacheDrawList: output of the last frame which submitted the window contents. Rendered instead of DrawList when DrawListCacheUsed is set.
+    ImGuiWindowDrawListCacheKey DrawListCacheKey;               // State affecting the output of the window (position, size, scroll, style, etc.) when DrawListCache was recorded.
+    ImVector<char>          DrawListCacheTitle;                 // Title ('name' parameter of Begin()) when DrawListCache was recorded.
+    bool                    DrawListCacheValid;                 // Set when DrawListCacheKey is valid, cleared when the output can't be reused.
+    bool                    DrawListCacheUsed;                  // Set when the contents were skipped this frame and DrawListCache is rendered.
+    int                     DrawListCacheNavLayersActiveMask;   // Layout state of the last frame which submitted the window contents, restored when they are skipped.
+    ImVec2                  DrawListCacheCursorMaxPos;
+    ImVec2                  DrawListCacheIdealMaxPos;
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup _or_ docked window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window. Doesn't cross through popups/dock nodes.
     ImGuiWindow*            RootWindowPopupTree;                // Point to ourself or first ancestor that is not a child window. Cross through popups parent<>child.
@@ -2122,6 +2360,12 @@ struct ImGuiTabBar
 typedef ImS8 ImGuiTableColumnIdx;
 typedef ImU8 ImGuiTableDrawChannelIdx;
 
+// Extend ImGuiTableFlags_
+enum ImGuiTableFlagsPrivate_
+{
+    ImGuiTableFlags_SingleDrawChannel           = 1 << 28   // Draw contents of all columns into a single draw channel with a shared clipping rectangle, instead of one channel per column merged by EndTable(). Cells straying off their column are clipped on the CPU (see TableClipCellDrawCmds())
+};
+
 // [Internal] sizeof() ~ 104
 // We use the terminology "Enabled" to refer to a column that is not Hidden by user/api.
 // We use the terminology "Clipped" to refer to a column that is out of sight because of scrolling/clipping.
@@ -2154,6 +2398,7 @@ struct ImGuiTableColumn
     ImGuiTableDrawChannelIdx DrawChannelCurrent;            // Index within DrawSplitter.Channels[]
     ImGuiTableDrawChannelIdx DrawChannelFrozen;             // Draw channels for frozen rows (often headers)
     ImGuiTableDrawChannelIdx DrawChannelUnfrozen;           // Draw channels for unfrozen rows
+    float                   DataSourceWidthMax;             // Width of the widest cell displayed by TableDataSourceRows() so far
     bool                    IsEnabled;                      // IsUserEnabled && (Flags & ImGuiTableColumnFlags_Disabled) == 0
     bool                    IsUserEnabled;                  // Is the column not marked Hidden by the user? (unrelated to being off view, e.g. clipped by scrolling).
     bool                    IsUserEnabledNextFrame;
@@ -2211,6 +2456,8 @@ struct IMGUI_API ImGuiTable
     int                         ColumnsCount;               // Number of columns declared in BeginTable()
     int                         CurrentRow;
     int                         CurrentColumn;
+    int                         CellDrawCmdStart;           // ImGuiTableFlags_SingleDrawChannel: index of the draw command current when the current cell began
+    unsigned int                CellDrawElemStart;          // ImGuiTableFlags_SingleDrawChannel: its ElemCount when the current cell began
     ImS16                       InstanceCurrent;            // Count of BeginTable() calls with same ID in the same frame (generally 0). This is a little bit similar to BeginCount for a window, but multiple table with same ID look are multiple tables, they are just synched.
     ImS16                       InstanceInteracted;         // Mark which instance (generally 0) of the same ID is being interacted with
     float                       RowPosY1;
@@ -2257,6 +2504,8 @@ struct IMGUI_API ImGuiTable
     ImGuiTableColumnSortSpecs   SortSpecsSingle;
     ImVector<ImGuiTableColumnSortSpecs> SortSpecsMulti;     // FIXME-OPT: Using a small-vector pattern would be good.
     ImGuiTableSortSpecs         SortSpecs;                  // Public facing sorts specs, this is what we return in TableGetSortSpecs()
+    ImVector<int>               DataSourceOrder;            // TableDataSourceRows(): rows in display order, sorted with SortSpecs (empty when not sorting)
+    ImGuiTableDataSourceSortJob* DataSourceSortJob;         // Sort of all rows running in the background, DataSourceOrder[] is the previous order meanwhile (NULL when none)
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns (<= ColumnsCount)
@@ -2286,6 +2535,7 @@ struct IMGUI_API ImGuiTable
     bool                        IsInsideRow;                // Set when inside TableBeginRow()/TableEndRow().
     bool                        IsInitializing;
     bool                        IsSortSpecsDirty;
+    bool                        IsDataSourceOrderDirty;     // Set when sort specs or data changed, DataSourceOrder[] needs to be sorted again.
     bool                        IsUsingHeaders;             // Set when the first row had the ImGuiTableRowFlags_Headers flag.
     bool                        IsContextPopupOpen;         // Set when default context menu is open (also see: ContextPopupColumn, InstanceInteracted).
     bool                        IsSettingsRequestLoad;
@@ -2396,6 +2646,13 @@ namespace ImGui
     IMGUI_API void          BringWindowToDisplayFront(ImGuiWindow* window);
     IMGUI_API void          BringWindowToDisplayBack(ImGuiWindow* window);
 
+    // Memory
+    IMGUI_API void*         MemAllocFrame(size_t size);                                 // Allocate from the frame arena: no need to free, valid until the next NewFrame(). Main thread only.
+    IMGUI_API ImGuiMemTag   GetMemTag();
+    IMGUI_API void          SetMemTag(ImGuiMemTag tag);                                 // Tag subsequent allocations of the current thread: save with GetMemTag() and restore after the allocating code.
+    IMGUI_API void          InstallAllocTracker(ImGuiAllocTracker* tracker);            // Wrap current allocator functions with an allocation tracker. Call before CreateContext().
+    IMGUI_API ImGuiAllocTracker* GetAllocTracker();                                     // Installed tracker, or NULL.
+
     // Fonts, drawing
     IMGUI_API void          SetCurrentFont(ImFont* font);
     inline ImFont*          GetDefaultFont() { ImGuiContext& g = *GImGui; return g.IO.FontDefault ? g.IO.FontDefault : g.IO.Fonts->Fonts[0]; }
@@ -2587,6 +2844,8 @@ namespace ImGui
     IMGUI_API void          TableBeginInitMemory(ImGuiTable* table, int columns_count);
     IMGUI_API void          TableBeginApplyRequests(ImGuiTable* table);
     IMGUI_API void          TableSetupDrawChannels(ImGuiTable* table);
+    IMGUI_API ImVec4        TableGetCellsClipRectForDrawCmd(const ImGuiTable* table, const ImGuiTableColumn* column);
+    IMGUI_API void          TableClipCellDrawCmds(ImGuiTable* table, ImGuiTableColumn* column, ImDrawList* draw_list);
     IMGUI_API void          TableUpdateLayout(ImGuiTable* table);
     IMGUI_API void          TableUpdateBorders(ImGuiTable* table);
     IMGUI_API void          TableUpdateColumnsWeightFromWidth(ImGuiTable* table);
@@ -2595,6 +2854,10 @@ namespace ImGui
     IMGUI_API void          TableMergeDrawChannels(ImGuiTable* table);
     IMGUI_API void          TableSortSpecsSanitize(ImGuiTable* table);
     IMGUI_API void          TableSortSpecsBuild(ImGuiTable* table);
+    IMGUI_API void          TableDataSourceSort(ImGuiTable* table, int rows_count, ImGuiTableCellGetter cell_getter, ImGuiTableRowsCompare rows_compare, void* user_data);
+    IMGUI_API void          TableDataSourceSortStart(ImGuiTable* table, int rows_count, ImGuiTableCellGetter cell_getter, ImGuiTableRowsCompare rows_compare, void* user_data);
+    IMGUI_API bool          TableDataSourceSortPoll(ImGuiTable* table);
+    IMGUI_API void          TableDataSourceSortCancel(ImGuiTable* table);
     IMGUI_API ImGuiSortDirection TableGetColumnNextSortDirection(ImGuiTableColumn* column);
     IMGUI_API void          TableFixColumnSortDirection(ImGuiTable* table, ImGuiTableColumn* column);
     IMGUI_API float         TableGetColumnWidthAuto(ImGuiTable* table, ImGuiTableColumn* column);
@@ -2778,6 +3041,17 @@ IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
+// Helpers for ImFontAtlasFlags_DynamicGlyphs (stb_truetype builder)
+// Glyphs available in the font but not rasterized yet have IM_FONTGLYPH_INDEX_PENDING in ImFont::IndexLookup[] and their final advance in IndexAdvanceX[].
+#define IM_FONTGLYPH_INDEX_PENDING  ((ImWchar)-2)
+IMGUI_API void      ImFontAtlasBuildDynamicMarkPending(ImFontAtlas* atlas, ImFont* font);
+IMGUI_API const ImFontGlyph* ImFontAtlasBuildDynamicGlyph(ImFontAtlas* atlas, ImFont* font, ImWchar codepoint);
+IMGUI_API void      ImFontAtlasBuildDestroyDynamicData(ImFontAtlas* atlas);
+IMGUI_API void      ImFontAtlasUpdateDynamicGlyphs(ImFontAtlas* atlas);     // Called by NewFrame(): grow the texture if a glyph didn't fit during the previous frame
+
+// Helper for ImGuiTextWrapCache
+IMGUI_API ImVec2    ImFontCalcTextLineStarts(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end, ImVector<int>* out_line_starts);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
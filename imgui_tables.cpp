@@ -14,6 +14,7 @@ Index of this file:
 // [SECTION] Tables: Columns width management
 // [SECTION] Tables: Drawing
 // [SECTION] Tables: Sorting
+// [SECTION] Tables: Data source
 // [SECTION] Tables: Headers
 // [SECTION] Tables: Context Menu
 // [SECTION] Tables: Settings (.ini data)
@@ -54,6 +55,9 @@ Index of this file:
 //    | TableSortSpecsClickColumn()             - when left-clicked: alter sort order and sort direction
 //    | TableOpenContextMenu()                  - when right-clicked: trigger opening of the default context menu
 // - TableGetSortSpecs()                        user queries updated sort specs (optional, generally after submitting headers)
+// - TableDataSourceRows()                      user lets the table submit the visible rows, instead of the calls below (optional)
+//    | TableDataSourceSort()                   - sort rows on sort specs change (or new rows only when appended), cache the display order
+//    | TableDataSourceSortStart()              - or sort all rows in the background (io.BackgroundJobFn), keep the previous order meanwhile
 // - TableNextRow()                             user begin into a new row (also automatically called by TableHeadersRow())
 //    | TableEndRow()                           - finish existing row
 //    | TableBeginRow()                         - add a new row
@@ -64,7 +68,7 @@ Index of this file:
 //-----------------------------------------------------------------------------
 // - EndTable()                                 user ends the table
 //    | TableDrawBorders()                      - draw outer borders, inner vertical borders
-//    | TableMergeDrawChannels()                - merge draw channels if clipping isn't required
+//    | TableMergeDrawChannels()                - merge draw channels if clipping isn't required (not with NoClip/SingleDrawChannel)
 //    | EndChild()                              - (if ScrollX/ScrollY is set)
 //-----------------------------------------------------------------------------
 
@@ -329,6 +333,8 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         ItemSize(outer_rect);
         return false;
     }
+    ImGuiMemTag backup_mem_tag = GetMemTag();
+    SetMemTag(ImGuiMemTag_Table);
 
     // Acquire storage for the table
     ImGuiTable* table = g.Tables.GetOrAddByKey(id);
@@ -556,6 +562,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
     // Apply queued resizing/reordering/hiding requests
     TableBeginApplyRequests(table);
 
+    SetMemTag(backup_mem_tag);
     return true;
 }
 
@@ -1197,6 +1204,8 @@ void    ImGui::EndTable()
     ImGuiContext& g = *GImGui;
     ImGuiTable* table = g.CurrentTable;
     IM_ASSERT(table != NULL && "Only call EndTable() if BeginTable() returns true!");
+    ImGuiMemTag backup_mem_tag = GetMemTag();
+    SetMemTag(ImGuiMemTag_Table);
 
     // This assert would be very useful to catch a common error... unfortunately it would probably trigger in some
     // cases, and for consistency user may sometimes output empty tables (and still benefit from e.g. outer border)
@@ -1274,7 +1283,7 @@ void    ImGui::EndTable()
     // Flatten channels and merge draw calls
     ImDrawListSplitter* splitter = table->DrawSplitter;
     splitter->SetCurrentChannel(inner_window->DrawList, 0);
-    if ((table->Flags & ImGuiTableFlags_NoClip) == 0)
+    if ((table->Flags & (ImGuiTableFlags_NoClip | ImGuiTableFlags_SingleDrawChannel)) == 0)
         TableMergeDrawChannels(table);
     splitter->Merge(inner_window->DrawList);
 
@@ -1390,6 +1399,7 @@ void    ImGui::EndTable()
         g.CurrentTable->DrawSplitter = &temp_data->DrawSplitter;
     }
     outer_window->DC.CurrentTableIdx = g.CurrentTable ? g.Tables.GetIndex(g.CurrentTable) : -1;
+    SetMemTag(backup_mem_tag);
 }
 
 // See "COLUMN SIZING POLICIES" comments at the top of this file
@@ -1967,6 +1977,22 @@ void ImGui::TableBeginCell(ImGuiTable* table, int column_n)
         table->DrawSplitter->SetCurrentChannel(window->DrawList, TABLE_DRAW_CHANNEL_NOCLIP);
         //IM_ASSERT(table->DrawSplitter._Current == TABLE_DRAW_CHANNEL_NOCLIP);
     }
+    else if ((table->Flags & ImGuiTableFlags_SingleDrawChannel) && column->DrawChannelCurrent != table->DummyDrawChannel)
+    {
+        // Items are clipped with the column ClipRect, and so is text on the CPU (ImFont::RenderText() culls glyphs with _CmdHeader.ClipRect),
+        // but the current draw command keeps a clip rect shared by all columns, so consecutive cells of a row segment end up in the same draw command.
+        // We remember where the cell begins in case its contents stray off the column (see TableEndCell).
+        ImDrawList* draw_list = window->DrawList;
+        const ImVec4 cells_clip_rect = TableGetCellsClipRectForDrawCmd(table, column);
+        SetWindowClipRectBeforeSetChannel(window, column->ClipRect);
+        draw_list->_CmdHeader.ClipRect = cells_clip_rect;
+        table->DrawSplitter->SetCurrentChannel(draw_list, column->DrawChannelCurrent);
+        if (memcmp(&draw_list->CmdBuffer.back().ClipRect, &cells_clip_rect, sizeof(ImVec4)) != 0)
+            draw_list->_OnChangedClipRect();
+        draw_list->_CmdHeader.ClipRect = window->ClipRect.ToVec4();
+        table->CellDrawCmdStart = draw_list->CmdBuffer.Size - 1;
+        table->CellDrawElemStart = draw_list->CmdBuffer.Data[table->CellDrawCmdStart].ElemCount;
+    }
     else
     {
         // FIXME-TABLE: Could avoid this if draw channel is dummy channel?
@@ -1999,6 +2025,11 @@ void ImGui::TableEndCell(ImGuiTable* table)
     table->RowPosY2 = ImMax(table->RowPosY2, window->DC.CursorMaxPos.y + table->CellPaddingY);
     column->ItemWidth = window->DC.ItemWidth;
 
+    // Contents strayed off the column: clip them (same test as TableMergeDrawChannels() uses to decide merging a column)
+    if ((table->Flags & (ImGuiTableFlags_NoClip | ImGuiTableFlags_SingleDrawChannel)) == ImGuiTableFlags_SingleDrawChannel && column->DrawChannelCurrent != table->DummyDrawChannel)
+        if (!(column->Flags & ImGuiTableColumnFlags_NoClip) && (window->DC.CursorMaxPos.x > column->ClipRect.Max.x || column->WorkMinX < column->ClipRect.Min.x))
+            TableClipCellDrawCmds(table, column, window->DrawList);
+
     // Propagate text baseline for the entire row
     // FIXME-TABLE: Here we propagate text baseline from the last line of the cell.. instead of the first one.
     table->RowTextBaseline = ImMax(table->RowTextBaseline, window->DC.PrevLineTextBaseOffset);
@@ -2205,6 +2236,8 @@ void ImGui::TableUpdateColumnsWeightFromWidth(ImGuiTable* table)
 // - TablePushBackgroundChannel() [Internal]
 // - TablePopBackgroundChannel() [Internal]
 // - TableSetupDrawChannels() [Internal]
+// - TableGetCellsClipRectForDrawCmd() [Internal]
+// - TableClipCellDrawCmds() [Internal]
 // - TableMergeDrawChannels() [Internal]
 // - TableDrawBorders() [Internal]
 //-------------------------------------------------------------------------
@@ -2232,7 +2265,17 @@ void ImGui::TablePopBackgroundChannel()
 
     // Optimization: avoid PopClipRect() + SetCurrentChannel()
     SetWindowClipRectBeforeSetChannel(window, table->HostBackupInnerClipRect);
-    table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
+    if ((table->Flags & (ImGuiTableFlags_NoClip | ImGuiTableFlags_SingleDrawChannel)) == ImGuiTableFlags_SingleDrawChannel && column->DrawChannelCurrent != table->DummyDrawChannel)
+    {
+        // Back to the draw command shared by columns, see TableBeginCell()
+        window->DrawList->_CmdHeader.ClipRect = TableGetCellsClipRectForDrawCmd(table, column);
+        table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
+        window->DrawList->_CmdHeader.ClipRect = window->ClipRect.ToVec4();
+    }
+    else
+    {
+        table->DrawSplitter->SetCurrentChannel(window->DrawList, column->DrawChannelCurrent);
+    }
 }
 
 // Allocate draw channels. Called by TableUpdateLayout()
@@ -2247,21 +2290,23 @@ void ImGui::TablePopBackgroundChannel()
 //   horizontal spanning. If we allowed vertical spanning we'd need one background draw channel per merge group (1-4).
 // Draw channel allocation (before merging):
 // - NoClip                       --> 2+D+1 channels: bg0/1 + bg2 + foreground (same clip rect == always 1 draw call)
+// - SingleDrawChannel            --> 2+D+1 channels: bg0/1 + bg2 + foreground, with or without FreezeRows (cells straying off their column are clipped on the CPU, see TableEndCell())
 // - Clip                         --> 2+D+N channels
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
 // Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
-    const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const bool single_draw_channel = (table->Flags & (ImGuiTableFlags_NoClip | ImGuiTableFlags_SingleDrawChannel)) == ImGuiTableFlags_SingleDrawChannel;
+    const int freeze_row_multiplier = (table->FreezeRowsCount > 0 && !single_draw_channel) ? 2 : 1;
+    const int channels_for_row = (table->Flags & (ImGuiTableFlags_NoClip | ImGuiTableFlags_SingleDrawChannel)) ? 1 : table->ColumnsEnabledCount;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
     const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || table->VisibleMaskByIndex != table->EnabledMaskByIndex) ? +1 : 0;
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
     table->Bg2DrawChannelCurrent = TABLE_DRAW_CHANNEL_BG2_FROZEN;
-    table->Bg2DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)((table->FreezeRowsCount > 0) ? 2 + channels_for_row : TABLE_DRAW_CHANNEL_BG2_FROZEN);
+    table->Bg2DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)((freeze_row_multiplier > 1) ? 2 + channels_for_row : TABLE_DRAW_CHANNEL_BG2_FROZEN);
 
     int draw_channel_current = 2;
     for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
@@ -2270,8 +2315,8 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
         if (column->IsVisibleX && column->IsVisibleY)
         {
             column->DrawChannelFrozen = (ImGuiTableDrawChannelIdx)(draw_channel_current);
-            column->DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)(draw_channel_current + (table->FreezeRowsCount > 0 ? channels_for_row + 1 : 0));
-            if (!(table->Flags & ImGuiTableFlags_NoClip))
+            column->DrawChannelUnfrozen = (ImGuiTableDrawChannelIdx)(draw_channel_current + (freeze_row_multiplier > 1 ? channels_for_row + 1 : 0));
+            if (!(table->Flags & (ImGuiTableFlags_NoClip | ImGuiTableFlags_SingleDrawChannel)))
                 draw_channel_current++;
         }
         else
@@ -2290,6 +2335,111 @@ void ImGui::TableSetupDrawChannels(ImGuiTable* table)
     IM_ASSERT(table->BgClipRect.Min.y <= table->BgClipRect.Max.y);
 }
 
+// ImGuiTableFlags_SingleDrawChannel: clip rect of the draw commands of cells, shared by all columns.
+// Horizontally the one of the host (as merged columns get in TableMergeDrawChannels()), vertically the one of columns (which changes past frozen rows).
+ImVec4 ImGui::TableGetCellsClipRectForDrawCmd(const ImGuiTable* table, const ImGuiTableColumn* column)
+{
+    return ImVec4(table->HostClipRect.Min.x, column->ClipRect.Min.y, table->HostClipRect.Max.x, column->ClipRect.Max.y);
+}
+
+// ImGuiTableFlags_SingleDrawChannel: clip on the CPU, horizontally, the triangles of the last draw command from 'idx_start'.
+// Triangles outside [clip_min_x, clip_max_x] are removed. Axis-aligned quads crossing it (text glyphs, filled rectangles, as output by PrimRectUV())
+// are cut, the same way ImFont::RenderText() does with 'cpu_fine_clip'. Return false if other triangles cross it: those are left untouched.
+static bool TableClipCellTrianglesX(ImDrawList* draw_list, unsigned int idx_start, float clip_min_x, float clip_max_x)
+{
+    ImDrawCmd* cmd = &draw_list->CmdBuffer.back();
+    IM_ASSERT(cmd->IdxOffset + cmd->ElemCount == (unsigned int)draw_list->IdxBuffer.Size);
+    ImDrawVert* vtx = draw_list->VtxBuffer.Data + cmd->VtxOffset;
+    ImDrawIdx* idx_read = draw_list->IdxBuffer.Data + cmd->IdxOffset + idx_start;
+    ImDrawIdx* idx_write = idx_read;
+    ImDrawIdx* idx_end = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+    bool all_clipped = true;
+    while (idx_read + 3 <= idx_end)
+    {
+        ImDrawVert* a = &vtx[idx_read[0]];
+        ImDrawVert* b = &vtx[idx_read[1]];
+        ImDrawVert* c = &vtx[idx_read[2]];
+        const float min_x = ImMin(a->pos.x, ImMin(b->pos.x, c->pos.x));
+        const float max_x = ImMax(a->pos.x, ImMax(b->pos.x, c->pos.x));
+        int idx_count = 3;
+        if (max_x <= clip_min_x || min_x >= clip_max_x)
+            idx_count = 0;
+        else if (min_x < clip_min_x || max_x > clip_max_x)
+        {
+            // Quad (a, b, c, d) from PrimRectUV(): indices (0,1,2, 0,2,3), edges a-b and c-d horizontal, UV mapped along the same axes
+            ImDrawVert* d = (idx_read + 6 <= idx_end) ? &vtx[idx_read[0] + 3] : NULL;
+            if (d != NULL && idx_read[1] == idx_read[0] + 1 && idx_read[2] == idx_read[0] + 2 && idx_read[3] == idx_read[0] && idx_read[4] == idx_read[2] && idx_read[5] == idx_read[0] + 3 &&
+                a->pos.y == b->pos.y && b->pos.x == c->pos.x && c->pos.y == d->pos.y && d->pos.x == a->pos.x &&
+                a->uv.y == b->uv.y && b->uv.x == c->uv.x && c->uv.y == d->uv.y && d->uv.x == a->uv.x && a->col == b->col && c->col == d->col)
+            {
+                const float x1 = ImMax(min_x, clip_min_x);
+                const float x2 = ImMin(max_x, clip_max_x);
+                const float u_scale = (b->uv.x - a->uv.x) / (b->pos.x - a->pos.x);
+                const float u1 = a->uv.x + (x1 - a->pos.x) * u_scale;
+                const float u2 = a->uv.x + (x2 - a->pos.x) * u_scale;
+                const bool a_is_left = a->pos.x < b->pos.x;
+                a->pos.x = d->pos.x = a_is_left ? x1 : x2;
+                b->pos.x = c->pos.x = a_is_left ? x2 : x1;
+                a->uv.x = d->uv.x = a_is_left ? u1 : u2;
+                b->uv.x = c->uv.x = a_is_left ? u2 : u1;
+                idx_count = 6;
+            }
+            else
+            {
+                all_clipped = false;
+            }
+        }
+        if (idx_count > 0 && idx_write != idx_read)
+            memmove(idx_write, idx_read, idx_count * sizeof(ImDrawIdx));
+        idx_write += idx_count;
+        idx_read += (idx_count == 6) ? 6 : 3;
+    }
+    const int idx_removed = (int)(idx_end - idx_write);
+    draw_list->IdxBuffer.Size -= idx_removed;
+    draw_list->_IdxWritePtr -= idx_removed;
+    cmd->ElemCount -= idx_removed;
+    return all_clipped;
+}
+
+// ImGuiTableFlags_SingleDrawChannel: contents of the current cell strayed off its column. Called by TableEndCell().
+// Triangles output in the shared draw command are clipped to the column on the CPU when possible, so stray cells don't cost extra draw calls.
+// Otherwise the draw commands output since the cell began are clipped with the column ClipRect, splitting the draw command the cell began in
+// (the next cell gets a new draw command with the shared clip rect, see TableBeginCell()).
+void ImGui::TableClipCellDrawCmds(ImGuiTable* table, ImGuiTableColumn* column, ImDrawList* draw_list)
+{
+    if (table->CellDrawCmdStart == draw_list->CmdBuffer.Size - 1)
+        if (TableClipCellTrianglesX(draw_list, table->CellDrawElemStart, column->ClipRect.Min.x, column->ClipRect.Max.x))
+            return;
+
+    int cmd_n = table->CellDrawCmdStart;
+    if (cmd_n == draw_list->CmdBuffer.Size - 1 && draw_list->CmdBuffer.Data[cmd_n].ElemCount == table->CellDrawElemStart)
+        return; // Nothing drawn
+    if (cmd_n < draw_list->CmdBuffer.Size && table->CellDrawElemStart > 0)
+    {
+        ImDrawCmd* cmd = &draw_list->CmdBuffer.Data[cmd_n];
+        if (cmd->ElemCount > table->CellDrawElemStart)
+        {
+            ImDrawCmd cell_cmd = *cmd;
+            cell_cmd.IdxOffset += table->CellDrawElemStart;
+            cell_cmd.ElemCount -= table->CellDrawElemStart;
+            cmd->ElemCount = table->CellDrawElemStart;
+            draw_list->CmdBuffer.insert(draw_list->CmdBuffer.Data + cmd_n + 1, cell_cmd);
+        }
+        cmd_n++;
+    }
+    const ImRect& clip_rect = column->ClipRect;
+    for (; cmd_n < draw_list->CmdBuffer.Size; cmd_n++)
+    {
+        ImDrawCmd* cmd = &draw_list->CmdBuffer.Data[cmd_n];
+        if (cmd->UserCallback != NULL || cmd->ElemCount == 0)
+            continue;
+        cmd->ClipRect.x = ImMax(cmd->ClipRect.x, clip_rect.Min.x);
+        cmd->ClipRect.y = ImMax(cmd->ClipRect.y, clip_rect.Min.y);
+        cmd->ClipRect.z = ImMin(cmd->ClipRect.z, clip_rect.Max.x);
+        cmd->ClipRect.w = ImMin(cmd->ClipRect.w, clip_rect.Max.y);
+    }
+}
+
 // This function reorder draw channels based on matching clip rectangle, to facilitate merging them. Called by EndTable().
 // For simplicity we call it TableMergeDrawChannels() but in fact it only reorder channels + overwrite ClipRect,
 // actual merging is done by table->DrawSplitter.Merge() which is called right after TableMergeDrawChannels().
@@ -2755,6 +2905,7 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
         table->SortSpecsMulti.resize(table->SortSpecsCount <= 1 ? 0 : table->SortSpecsCount);
         table->SortSpecs.SpecsDirty = true; // Mark as dirty for user
         table->IsSortSpecsDirty = false; // Mark as not dirty for us
+        table->IsDataSourceOrderDirty = true;
     }
 
     // Write output
@@ -2777,6 +2928,531 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Tables: Data source
+//-------------------------------------------------------------------------
+// - TableDataSourceRows()
+// - TableSetDataSourceDirty()
+// - TableSortRows()
+// - TableIsDataSourceSorting()
+// - TableDataSourceSort() [Internal]
+// - TableDataSourceSortStart() [Internal]
+// - TableDataSourceSortPoll() [Internal]
+// - TableDataSourceSortCancel() [Internal]
+//-------------------------------------------------------------------------
+
+// Rows count from which sorting all rows runs in the background, when io.BackgroundJobFn is set (smaller sorts take less than a frame)
+static const int TABLE_DATA_SOURCE_BACKGROUND_SORT_MIN = 10000;
+
+struct ImGuiTableDataSourceSortData
+{
+    const ImGuiTableColumnSortSpecs*    Specs;
+    int                                 SpecsCount;
+    ImGuiTableCellGetter                CellGetter;
+    ImGuiTableRowsCompare               RowsCompare;
+    void*                               UserData;
+    ImGuiParallelForFunc                ParallelForFn;      // Copy of io.ParallelForFn: background sorts don't access the ImGui context
+    void*                               ParallelForUserData;
+    const int*                          Cancel;             // Background sorts: stop early when set (atomic), the result is discarded
+};
+
+// A sort of all rows running in the background: it only accesses its own data (filling and sorting 'Rows' included), and stores 'Done' once 'Rows' is sorted.
+struct ImGuiTableDataSourceSortJob
+{
+    ImGuiTableDataSourceSortData        Data;
+    ImVector<ImGuiTableColumnSortSpecs> Specs;              // Copy of the sort specs, which may change while sorting
+    ImVector<int>                       Rows;
+    ImVector<int>                       Temp;
+    int                                 RowsCount;
+    int                                 Done;               // Set by the job (atomic)
+    int                                 Cancel;             // Set by TableDataSourceSortCancel() or when the sort specs/data changed (atomic)
+
+    ImGuiTableDataSourceSortJob()       { memset(&Data, 0, sizeof(Data)); RowsCount = Done = Cancel = 0; }
+};
+
+// Remove the rows past 'rows_count' from an order, which stays sorted
+static void TableDataSourceRemoveRows(ImVector<int>& order, int rows_count)
+{
+    int* out = order.Data;
+    for (int display_n = 0; display_n < order.Size; display_n++)
+        if (order.Data[display_n] < rows_count)
+            *out++ = order.Data[display_n];
+    order.resize(rows_count);
+}
+
+// Sort specs changed, rows appended or data changed: update the cached display order. Return NULL when not sorting.
+// While all rows are sorted in the background, the previous order is returned, with the rows appended since then displayed last.
+static const int* TableDataSourceUpdateOrder(ImGuiTable* table, int rows_count, ImGuiTableCellGetter cell_getter, ImGuiTableRowsCompare rows_compare, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    ImVector<int>& order = table->DataSourceOrder;
+    ImGui::TableDataSourceSortPoll(table);
+
+    // (TableGetSortSpecs() locks the layout, as the first TableNextRow() would)
+    if (ImGui::TableGetSortSpecs() != NULL && table->SortSpecsCount > 0)
+    {
+        if (table->DataSourceSortJob == NULL && (table->IsDataSourceOrderDirty || order.Size != rows_count))
+        {
+            const bool sort_all_rows = table->IsDataSourceOrderDirty || order.Size == 0;
+            if (sort_all_rows && g.IO.BackgroundJobFn != NULL && rows_count >= TABLE_DATA_SOURCE_BACKGROUND_SORT_MIN)
+                ImGui::TableDataSourceSortStart(table, rows_count, cell_getter, rows_compare, user_data);
+            else
+                ImGui::TableDataSourceSort(table, rows_count, cell_getter, rows_compare, user_data);
+        }
+        if (ImGuiTableDataSourceSortJob* job = table->DataSourceSortJob)
+        {
+            // Sort specs or data changed again: stop early, sort again once the job returned
+            if (table->IsDataSourceOrderDirty)
+                ImAtomicStore(&job->Cancel, 1);
+            if (order.Size > rows_count)
+                TableDataSourceRemoveRows(order, rows_count);
+            if (order.Size < rows_count)
+            {
+                order.reserve(rows_count);
+                while (order.Size < rows_count)
+                    order.push_back(order.Size);
+            }
+        }
+        return order.Data;
+    }
+    if (table->DataSourceSortJob != NULL)
+        ImAtomicStore(&table->DataSourceSortJob->Cancel, 1);
+    if (order.Size > 0)
+        order.clear();
+    return NULL;
+}
+
+// Submit the visible rows of a table whose cells are pulled from user data, in the order of the sort specs.
+// This is the usual TableNextRow() + ImGuiListClipper loop, plus:
+// - The sorted display order is cached in table->DataSourceOrder[], so sorting happens once per sort specs change instead of every frame.
+// - Cells are only requested for visible columns (TableSetColumnIndex() returns false for columns scrolled out of view).
+// - The widest cell of each column is remembered: with only the visible rows submitted, auto-fit widths would change while scrolling.
+void ImGui::TableDataSourceRows(int rows_count, ImGuiTableCellGetter cell_getter, ImGuiTableRowsCompare rows_compare, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableDataSourceRows() after BeginTable()!");
+    IM_ASSERT(rows_count >= 0 && cell_getter != NULL);
+    const int* order = TableDataSourceUpdateOrder(table, rows_count, cell_getter, rows_compare, user_data);
+
+    ImGuiWindow* window = table->InnerWindow;
+    char buf[512];
+    ImGuiListClipper clipper;
+    clipper.Begin(rows_count);
+    while (clipper.Step())
+        for (int display_n = clipper.DisplayStart; display_n < clipper.DisplayEnd; display_n++)
+        {
+            const int row_n = order ? order[display_n] : display_n;
+            TableNextRow();
+            for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+            {
+                if (!TableSetColumnIndex(column_n))
+                    continue;
+                ImGuiTableColumn* column = &table->Columns[column_n];
+                const float start_x = window->DC.CursorPos.x;
+                const char* text = cell_getter(user_data, row_n, column_n, buf, IM_ARRAYSIZE(buf));
+                TextUnformatted(text ? text : "");
+                column->DataSourceWidthMax = ImMax(column->DataSourceWidthMax, window->DC.CursorMaxPos.x - start_x);
+                window->DC.CursorMaxPos.x = start_x + column->DataSourceWidthMax;
+            }
+        }
+}
+
+// Data changed: sort again and forget the measured widths.
+void ImGui::TableSetDataSourceDirty()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableSetDataSourceDirty() after BeginTable()!");
+    table->IsDataSourceOrderDirty = true;
+    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+        table->Columns[column_n].DataSourceWidthMax = 0.0f;
+}
+
+// The cached sort of TableDataSourceRows(), for applications submitting rows themselves (e.g. with their own clipper loop).
+const int* ImGui::TableSortRows(int rows_count, ImGuiTableRowsCompare rows_compare, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableSortRows() after BeginTable()!");
+    IM_ASSERT(rows_count >= 0 && rows_compare != NULL);
+    return TableDataSourceUpdateOrder(table, rows_count, NULL, rows_compare, user_data);
+}
+
+bool ImGui::TableIsDataSourceSorting()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL && "Need to call TableIsDataSourceSorting() after BeginTable()!");
+    return table->DataSourceSortJob != NULL;
+}
+
+static void TableDataSourceInitSortData(ImGuiTableDataSourceSortData* data, const ImGuiTableColumnSortSpecs* specs, int specs_count, ImGuiTableCellGetter cell_getter, ImGuiTableRowsCompare rows_compare, void* user_data)
+{
+    ImGuiIO& io = GImGui->IO;
+    data->Specs = specs;
+    data->SpecsCount = specs_count;
+    data->CellGetter = cell_getter;
+    data->RowsCompare = rows_compare;
+    data->UserData = user_data;
+    data->ParallelForFn = io.ParallelForFn;
+    data->ParallelForUserData = io.ParallelForUserData;
+    data->Cancel = NULL;
+}
+
+static inline bool TableDataSourceSortCancelled(const ImGuiTableDataSourceSortData* data)
+{
+    return data->Cancel != NULL && ImAtomicLoad(data->Cancel) != 0;
+}
+
+static int TableDataSourceCompareRows(const ImGuiTableDataSourceSortData* data, int row_a, int row_b)
+{
+    for (int spec_n = 0; spec_n < data->SpecsCount; spec_n++)
+    {
+        const ImGuiTableColumnSortSpecs* spec = &data->Specs[spec_n];
+        int delta;
+        if (data->RowsCompare)
+        {
+            delta = data->RowsCompare(data->UserData, row_a, row_b, spec->ColumnIndex);
+        }
+        else
+        {
+            char buf_a[256], buf_b[256];
+            const char* text_a = data->CellGetter(data->UserData, row_a, spec->ColumnIndex, buf_a, IM_ARRAYSIZE(buf_a));
+            const char* text_b = data->CellGetter(data->UserData, row_b, spec->ColumnIndex, buf_b, IM_ARRAYSIZE(buf_b));
+            delta = strcmp(text_a ? text_a : "", text_b ? text_b : "");
+        }
+        if (delta != 0)
+            return (spec->SortDirection == ImGuiSortDirection_Descending) ? -delta : delta;
+    }
+    return 0;
+}
+
+// Merge two sorted runs into 'out'. Ties are taken from the first run, which keeps the sort stable.
+static void TableDataSourceMergeRuns(const ImGuiTableDataSourceSortData* data, const int* a, int a_count, const int* b, int b_count, int* out)
+{
+    const int* a_end = a + a_count;
+    const int* b_end = b + b_count;
+    while (a < a_end && b < b_end)
+        *out++ = (TableDataSourceCompareRows(data, *b, *a) < 0) ? *b++ : *a++;
+    while (a < a_end)
+        *out++ = *a++;
+    while (b < b_end)
+        *out++ = *b++;
+}
+
+// Return how many of the first 'out_n' rows of TableDataSourceMergeRuns(a, b) come from 'a' (binary search on the 'merge path'),
+// so a merge can be split into slices merged independently.
+static int TableDataSourceMergeSplit(const ImGuiTableDataSourceSortData* data, const int* a, int a_count, const int* b, int b_count, int out_n)
+{
+    int lo = ImMax(0, out_n - b_count);
+    int hi = ImMin(out_n, a_count);
+    while (lo < hi)
+    {
+        const int a_n = (lo + hi) / 2;
+        const int b_n = out_n - a_n;
+        if (TableDataSourceCompareRows(data, b[b_n - 1], a[a_n]) >= 0) // a[a_n] is output before b[b_n - 1]: take more rows from 'a'
+            lo = a_n + 1;
+        else
+            hi = a_n;
+    }
+    return lo;
+}
+
+// Stable bottom-up merge sort: insertion sort runs of 32 rows, then merge runs of doubling size back and forth between 'rows' and 'temp'.
+// (the user compare function doesn't take a context with ImQsort(), and would make equal rows order unspecified)
+static void TableDataSourceMergeSort(const ImGuiTableDataSourceSortData* data, int* rows, int* temp, int rows_count)
+{
+    const int RUN_SIZE = 32;
+    for (int start = 0; start < rows_count; start += RUN_SIZE)
+    {
+        if (TableDataSourceSortCancelled(data))
+            return;
+        const int end = ImMin(start + RUN_SIZE, rows_count);
+        for (int i = start + 1; i < end; i++)
+        {
+            const int row = rows[i];
+            int j = i;
+            for (; j > start && TableDataSourceCompareRows(data, rows[j - 1], row) > 0; j--)
+                rows[j] = rows[j - 1];
+            rows[j] = row;
+        }
+    }
+    int* src = rows;
+    int* dst = temp;
+    for (int width = RUN_SIZE; width < rows_count; width *= 2)
+    {
+        for (int start = 0, mid, end; start < rows_count; start = end)
+        {
+            if (TableDataSourceSortCancelled(data))
+                return;
+            mid = start + ImMin(width, rows_count - start);
+            end = mid + ImMin(width, rows_count - mid);
+            TableDataSourceMergeRuns(data, src + start, mid - start, src + mid, end - mid, dst + start);
+        }
+        ImSwap(src, dst);
+    }
+    if (src != rows)
+        memcpy(rows, src, (size_t)rows_count * sizeof(int));
+}
+
+// Large sorts are split into jobs running on io.ParallelForFn: sorting slices of rows, then merging sorted runs two by two.
+// Each merge is itself split into slices of the same size, so the last passes (a few long runs) still use every thread.
+// Jobs only read the sort data and write to their own range of 'Rows'/'Temp', they don't access the ImGui context.
+struct ImGuiTableDataSourceMergeJob
+{
+    const int*  A;
+    const int*  B;
+    int*        Out;
+    int         ACount;
+    int         BCount;
+};
+
+struct ImGuiTableDataSourceSortJobs
+{
+    const ImGuiTableDataSourceSortData*     Data;
+    int*                                    Rows;
+    int*                                    Temp;
+    ImVector<int>                           RunStarts;  // Sorted runs are [RunStarts[n], RunStarts[n + 1]), the last entry is the rows count
+    ImVector<ImGuiTableDataSourceMergeJob>  Merges;
+};
+
+static void TableDataSourceSortJob(void* job_data, int job_index)
+{
+    ImGuiTableDataSourceSortJobs* jobs = (ImGuiTableDataSourceSortJobs*)job_data;
+    const int start = jobs->RunStarts[job_index];
+    const int end = jobs->RunStarts[job_index + 1];
+    TableDataSourceMergeSort(jobs->Data, jobs->Rows + start, jobs->Temp + start, end - start);
+}
+
+static void TableDataSourceMergeJob(void* job_data, int job_index)
+{
+    ImGuiTableDataSourceSortJobs* jobs = (ImGuiTableDataSourceSortJobs*)job_data;
+    const ImGuiTableDataSourceMergeJob* job = &jobs->Merges[job_index];
+    TableDataSourceMergeRuns(jobs->Data, job->A, job->ACount, job->B, job->BCount, job->Out);
+}
+
+static void TableDataSourceParallelFor(const ImGuiTableDataSourceSortData* data, ImGuiJobFunc job_func, void* job_data, int job_count)
+{
+    if (data->ParallelForFn != NULL && job_count > 1)
+        data->ParallelForFn(job_func, job_data, job_count, data->ParallelForUserData);
+    else
+        for (int job_n = 0; job_n < job_count; job_n++)
+            job_func(job_data, job_n);
+}
+
+static int TableDataSourceCalcJobsCount(const ImGuiTableDataSourceSortData* data, int rows_count)
+{
+    const int JOB_ROWS_MIN = 16384;
+    const int JOBS_MAX = 64;
+    return (data->ParallelForFn != NULL) ? ImClamp(rows_count / JOB_ROWS_MIN, 1, JOBS_MAX) : 1;
+}
+
+// Merge runs two by two from 'src' into 'dst', in about 'slices_count' jobs of the same size.
+static void TableDataSourceMergePass(ImGuiTableDataSourceSortJobs* jobs, const int* src, int* dst, int slices_count)
+{
+    ImVector<int>& starts = jobs->RunStarts;
+    const int runs_count = starts.Size - 1;
+    const int rows_count = starts[runs_count];
+    const int slice_size = ImMax(rows_count / slices_count, 1);
+    jobs->Merges.resize(0);
+    for (int run_n = 0; run_n < runs_count; run_n += 2)
+    {
+        const int a_start = starts[run_n];
+        const int b_start = starts[run_n + 1];
+        const int b_end = (run_n + 1 < runs_count) ? starts[run_n + 2] : b_start;
+        const int* a = src + a_start;
+        const int* b = src + b_start;
+        const int a_count = b_start - a_start;
+        const int b_count = b_end - b_start;
+        const int out_count = a_count + b_count;
+        const int slices = ImMax(out_count / slice_size, 1);
+        for (int slice_n = 0, out_n = 0, a_n = 0; slice_n < slices; slice_n++)
+        {
+            const int next_out_n = (slice_n + 1 == slices) ? out_count : (int)((ImS64)out_count * (slice_n + 1) / slices);
+            const int next_a_n = (slice_n + 1 == slices) ? a_count : TableDataSourceMergeSplit(jobs->Data, a, a_count, b, b_count, next_out_n);
+            ImGuiTableDataSourceMergeJob job;
+            job.A = a + a_n;
+            job.B = b + (out_n - a_n);
+            job.Out = dst + a_start + out_n;
+            job.ACount = next_a_n - a_n;
+            job.BCount = (next_out_n - next_a_n) - (out_n - a_n);
+            jobs->Merges.push_back(job);
+            out_n = next_out_n;
+            a_n = next_a_n;
+        }
+    }
+    for (int run_n = 0; run_n < runs_count; run_n += 2)
+        starts[run_n / 2] = starts[run_n];
+    starts.resize((runs_count + 1) / 2 + 1);
+    starts.back() = rows_count;
+    TableDataSourceParallelFor(jobs->Data, TableDataSourceMergeJob, jobs, jobs->Merges.Size);
+}
+
+// Sort 'rows' using 'temp' as scratch, on one thread or as jobs for io.ParallelForFn.
+static void TableDataSourceSortRows(const ImGuiTableDataSourceSortData* data, int* rows, int* temp, int rows_count)
+{
+    const int jobs_count = TableDataSourceCalcJobsCount(data, rows_count);
+    if (jobs_count == 1)
+    {
+        TableDataSourceMergeSort(data, rows, temp, rows_count);
+        return;
+    }
+
+    ImGuiTableDataSourceSortJobs jobs;
+    jobs.Data = data;
+    jobs.Rows = rows;
+    jobs.Temp = temp;
+    jobs.RunStarts.resize(jobs_count + 1);
+    for (int job_n = 0; job_n <= jobs_count; job_n++)
+        jobs.RunStarts[job_n] = (int)((ImS64)rows_count * job_n / jobs_count);
+    TableDataSourceParallelFor(data, TableDataSourceSortJob, &jobs, jobs_count);
+
+    int* src = rows;
+    int* dst = temp;
+    while (jobs.RunStarts.Size > 2 && !TableDataSourceSortCancelled(data))
+    {
+        TableDataSourceMergePass(&jobs, src, dst, jobs_count);
+        ImSwap(src, dst);
+    }
+    if (src != rows)
+        memcpy(rows, src, (size_t)rows_count * sizeof(int));
+}
+
+// Merge a few sorted new rows into many sorted rows, in place: each new row is placed with a binary search, from the last one,
+// and the rows after it are moved once. Ties are placed after the existing rows, as a stable sort of all rows would.
+static void TableDataSourceInsertRows(const ImGuiTableDataSourceSortData* data, int* rows, int rows_count, const int* new_rows, int new_count)
+{
+    int end = rows_count;
+    for (int new_n = new_count - 1; new_n >= 0; new_n--)
+    {
+        const int new_row = new_rows[new_n];
+        int lo = 0, hi = end;
+        while (lo < hi)
+        {
+            const int mid = (lo + hi) / 2;
+            if (TableDataSourceCompareRows(data, rows[mid], new_row) > 0)
+                hi = mid;
+            else
+                lo = mid + 1;
+        }
+        memmove(rows + lo + new_n + 1, rows + lo, (size_t)(end - lo) * sizeof(int));
+        rows[lo + new_n] = new_row;
+        end = lo;
+    }
+}
+
+// Sort rows on the current sort specs (called when sort specs, rows count or data changed)
+// - Rows appended (rows_count grew and the order isn't dirty): only sort the new rows, then merge them with the sorted ones.
+// - Rows removed from the end: remove them from the order, which stays sorted.
+void ImGui::TableDataSourceSort(ImGuiTable* table, int rows_count, ImGuiTableCellGetter cell_getter, ImGuiTableRowsCompare rows_compare, void* user_data)
+{
+    IM_ASSERT(table->SortSpecsCount > 0 && table->SortSpecs.Specs != NULL);
+    IM_ASSERT(cell_getter != NULL || rows_compare != NULL);
+    ImVector<int>& order = table->DataSourceOrder;
+    const int sorted_count = table->IsDataSourceOrderDirty ? 0 : order.Size;
+    table->IsDataSourceOrderDirty = false;
+
+    if (sorted_count >= rows_count)
+    {
+        TableDataSourceRemoveRows(order, rows_count);
+        return;
+    }
+
+    ImGuiTableDataSourceSortData data;
+    TableDataSourceInitSortData(&data, table->SortSpecs.Specs, table->SortSpecs.SpecsCount, cell_getter, rows_compare, user_data);
+
+    const int new_count = rows_count - sorted_count;
+    order.resize(rows_count);
+    int* rows = order.Data;
+    for (int row_n = sorted_count; row_n < rows_count; row_n++)
+        rows[row_n] = row_n;
+    ImVector<int> temp;
+    temp.resize(new_count);
+    TableDataSourceSortRows(&data, rows + sorted_count, temp.Data, new_count);
+    if (sorted_count == 0)
+        return;
+
+    // A few rows appended (e.g. a live log): about log2(sorted_count) comparisons per new row, instead of a comparison per row.
+    if (new_count < sorted_count / 32)
+    {
+        memcpy(temp.Data, rows + sorted_count, (size_t)new_count * sizeof(int));
+        TableDataSourceInsertRows(&data, rows, sorted_count, temp.Data, new_count);
+        return;
+    }
+    ImGuiTableDataSourceSortJobs jobs;
+    jobs.Data = &data;
+    jobs.Rows = rows;
+    jobs.Temp = NULL;
+    jobs.RunStarts.resize(3);
+    jobs.RunStarts[0] = 0;
+    jobs.RunStarts[1] = sorted_count;
+    jobs.RunStarts[2] = rows_count;
+    temp.resize(rows_count);
+    TableDataSourceMergePass(&jobs, rows, temp.Data, TableDataSourceCalcJobsCount(&data, rows_count));
+    memcpy(rows, temp.Data, (size_t)rows_count * sizeof(int));
+}
+
+static void TableDataSourceBackgroundSortJob(void* job_data, int job_index)
+{
+    IM_UNUSED(job_index);
+    ImGuiTableDataSourceSortJob* job = (ImGuiTableDataSourceSortJob*)job_data;
+    job->Rows.resize(job->RowsCount);
+    for (int row_n = 0; row_n < job->RowsCount; row_n++)
+        job->Rows[row_n] = row_n;
+    job->Temp.resize(job->RowsCount);
+    TableDataSourceSortRows(&job->Data, job->Rows.Data, job->Temp.Data, job->RowsCount);
+    job->Temp.clear();
+    ImAtomicStore(&job->Done, 1);
+}
+
+// Sort all rows on the current sort specs with io.BackgroundJobFn. DataSourceOrder[] is left untouched, the result is swapped in by TableDataSourceSortPoll().
+void ImGui::TableDataSourceSortStart(ImGuiTable* table, int rows_count, ImGuiTableCellGetter cell_getter, ImGuiTableRowsCompare rows_compare, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT(table->SortSpecsCount > 0 && table->SortSpecs.Specs != NULL);
+    IM_ASSERT(cell_getter != NULL || rows_compare != NULL);
+    IM_ASSERT(table->DataSourceSortJob == NULL && g.IO.BackgroundJobFn != NULL);
+    table->IsDataSourceOrderDirty = false;
+
+    ImGuiTableDataSourceSortJob* job = IM_NEW(ImGuiTableDataSourceSortJob)();
+    job->Specs.resize(table->SortSpecs.SpecsCount);
+    memcpy(job->Specs.Data, table->SortSpecs.Specs, (size_t)job->Specs.size_in_bytes());
+    TableDataSourceInitSortData(&job->Data, job->Specs.Data, job->Specs.Size, cell_getter, rows_compare, user_data);
+    job->Data.Cancel = &job->Cancel;
+    job->RowsCount = rows_count;
+    table->DataSourceSortJob = job;
+    g.IO.BackgroundJobFn(TableDataSourceBackgroundSortJob, job, g.IO.BackgroundJobUserData);
+}
+
+// Once the background sort returned: swap its result in, unless it was cancelled or the sort specs/data changed meanwhile. Return true while it runs.
+bool ImGui::TableDataSourceSortPoll(ImGuiTable* table)
+{
+    ImGuiTableDataSourceSortJob* job = table->DataSourceSortJob;
+    if (job == NULL)
+        return false;
+    if (ImAtomicLoad(&job->Done) == 0)
+        return true;
+    if (ImAtomicLoad(&job->Cancel) == 0 && !table->IsDataSourceOrderDirty)
+        table->DataSourceOrder.swap(job->Rows);
+    IM_DELETE(job);
+    table->DataSourceSortJob = NULL;
+    return false;
+}
+
+// Stop the background sort and wait for it to return (table or context destroyed).
+// The job checks the cancel flag between runs and merges of sorted runs, so this waits for one merge at most.
+void ImGui::TableDataSourceSortCancel(ImGuiTable* table)
+{
+    ImGuiTableDataSourceSortJob* job = table->DataSourceSortJob;
+    if (job == NULL)
+        return;
+    ImAtomicStore(&job->Cancel, 1);
+    while (ImAtomicLoad(&job->Done) == 0) {}
+    IM_DELETE(job);
+    table->DataSourceSortJob = NULL;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -3155,7 +3831,10 @@ static size_t TableSettingsCalcChunkSize(int columns_count)
 ImGuiTableSettings* ImGui::TableSettingsCreate(ImGuiID id, int columns_count)
 {
     ImGuiContext& g = *GImGui;
+    ImGuiMemTag backup_mem_tag = GetMemTag();
+    SetMemTag(ImGuiMemTag_Settings);
     ImGuiTableSettings* settings = g.SettingsTables.alloc_chunk(TableSettingsCalcChunkSize(columns_count));
+    SetMemTag(backup_mem_tag);
     TableSettingsInit(settings, id, columns_count, columns_count);
     return settings;
 }
@@ -3452,6 +4131,7 @@ void ImGui::TableRemove(ImGuiTable* table)
     int table_idx = g.Tables.GetIndex(table);
     //memset(table->RawData.Data, 0, table->RawData.size_in_bytes());
     //memset(table, 0, sizeof(ImGuiTable));
+    TableDataSourceSortCancel(table);
     g.Tables.Remove(table->ID, table);
     g.TablesLastTimeActive[table_idx] = -1.0f;
 }
@@ -3465,6 +4145,8 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
     table->SortSpecs.Specs = NULL;
     table->SortSpecsMulti.clear();
     table->IsSortSpecsDirty = true; // FIXME: shouldn't have to leak into user performing a sort
+    table->DataSourceOrder.clear();
+    table->IsDataSourceOrderDirty = true;
     table->ColumnsNames.clear();
     table->MemoryCompacted = true;
     for (int n = 0; n < table->ColumnsCount; n++)
@@ -3537,6 +4219,8 @@ void ImGui::DebugNodeTable(ImGuiTable* table)
     BulletText("CellPaddingX: %.1f, CellSpacingX: %.1f/%.1f, OuterPaddingX: %.1f", table->CellPaddingX, table->CellSpacingX1, table->CellSpacingX2, table->OuterPaddingX);
     BulletText("HoveredColumnBody: %d, HoveredColumnBorder: %d", table->HoveredColumnBody, table->HoveredColumnBorder);
     BulletText("ResizedColumn: %d, ReorderColumn: %d, HeldHeaderColumn: %d", table->ResizedColumn, table->ReorderColumn, table->HeldHeaderColumn);
+    if (table->DataSourceOrder.Size > 0)
+        BulletText("DataSourceOrder: %d rows sorted%s", table->DataSourceOrder.Size, table->DataSourceSortJob ? " (previous order, sorting in the background)" : "");
     //BulletText("BgDrawChannels: %d/%d", 0, table->BgDrawChannelUnfrozen);
     float sum_weights = 0.0f;
     for (int n = 0; n < table->ColumnsCount; n++)
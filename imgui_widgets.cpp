@@ -239,6 +239,32 @@ void ImGui::TextEx(const char* text, const char* text_end, ImGuiTextFlags flags)
         ItemSize(text_size, 0.0f);
         ItemAdd(bb, 0);
     }
+    else if (text_end - text > IM_TEXT_WRAP_CACHE_MIN_LEN && wrap_enabled && g.IO.ConfigTextLayoutCache)
+    {
+        // Long wrapped text!
+        // Line breaks are cached (see ImGuiTextWrapCache): only lay out the text again when it changes, and only render the visible lines.
+        const float wrap_width = CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x);
+        const ImGuiTextWrapEntry* layout = g.TextWrapCache.GetEntry(g.Font, g.FontSize, wrap_width, text_begin, text_end);
+        const ImVec2 text_size(IM_FLOOR(layout->Size.x + 0.99999f), layout->Size.y); // Same rounding as CalcTextSize()
+
+        ImRect bb(text_pos, text_pos + text_size);
+        ItemSize(text_size, 0.0f);
+        if (!ItemAdd(bb, 0))
+            return;
+
+        const float line_height = g.FontSize;
+        const int lines_count = layout->LineStarts.Size;
+        const int line_first = ImClamp((int)((window->ClipRect.Min.y - text_pos.y) / line_height) - 1, 0, lines_count); // One more line above, as glyphs may overhang the line below
+        const int line_last = ImClamp((int)((window->ClipRect.Max.y - text_pos.y) / line_height) + 1, line_first, lines_count);
+        if (line_first < line_last)
+        {
+            const char* line = text_begin + layout->LineStarts[line_first];
+            const char* line_end = (line_last < lines_count) ? text_begin + layout->LineStarts[line_last] : text_end;
+            window->DrawList->AddText(g.Font, g.FontSize, ImVec2(text_pos.x, text_pos.y + line_first * line_height), GetColorU32(ImGuiCol_Text), line, line_end, wrap_width);
+        }
+        if (g.LogEnabled)
+            LogRenderedText(&bb.Min, text_begin, text_end);
+    }
     else
     {
         const float wrap_width = wrap_enabled ? CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x) : 0.0f;
@@ -4326,10 +4352,9 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 const int ib = state->HasSelection() ? ImMin(state->Stb.select_start, state->Stb.select_end) : 0;
                 const int ie = state->HasSelection() ? ImMax(state->Stb.select_start, state->Stb.select_end) : state->CurLenW;
                 const int clipboard_data_len = ImTextCountUtf8BytesFromStr(state->TextW.Data + ib, state->TextW.Data + ie) + 1;
-                char* clipboard_data = (char*)IM_ALLOC(clipboard_data_len * sizeof(char));
+                char* clipboard_data = (char*)MemAllocFrame(clipboard_data_len * sizeof(char));
                 ImTextStrToUtf8(clipboard_data, clipboard_data_len, state->TextW.Data + ib, state->TextW.Data + ie);
                 SetClipboardText(clipboard_data);
-                MemFree(clipboard_data);
             }
             if (is_cut)
             {
@@ -4345,7 +4370,7 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
             {
                 // Filter pasted buffer
                 const int clipboard_len = (int)strlen(clipboard);
-                ImWchar* clipboard_filtered = (ImWchar*)IM_ALLOC((clipboard_len + 1) * sizeof(ImWchar));
+                ImWchar* clipboard_filtered = (ImWchar*)MemAllocFrame((clipboard_len + 1) * sizeof(ImWchar));
                 int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s; )
                 {
@@ -4363,7 +4388,6 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                     stb_textedit_paste(state, &state->Stb, clipboard_filtered, clipboard_filtered_len);
                     state->CursorFollow = true;
                 }
-                MemFree(clipboard_filtered);
             }
         }
 
@@ -4385,13 +4409,15 @@ bool ImGui::InputTextEx(const char* label, const char* hint, char* buf, int buf_
                 // Push records into the undo stack so we can CTRL+Z the revert operation itself
                 apply_new_text = state->InitialTextA.Data;
                 apply_new_text_length = state->InitialTextA.Size - 1;
-                ImVector<ImWchar> w_text;
+                ImWchar* w_text = NULL;
+                int w_text_len = 0;
                 if (apply_new_text_length > 0)
                 {
-                    w_text.resize(ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length) + 1);
-                    ImTextStrFromUtf8(w_text.Data, w_text.Size, apply_new_text, apply_new_text + apply_new_text_length);
+                    w_text_len = ImTextCountCharsFromUtf8(apply_new_text, apply_new_text + apply_new_text_length);
+                    w_text = (ImWchar*)MemAllocFrame((w_text_len + 1) * sizeof(ImWchar));
+                    ImTextStrFromUtf8(w_text, w_text_len + 1, apply_new_text, apply_new_text + apply_new_text_length);
                 }
-                stb_textedit_replace(state, &state->Stb, w_text.Data, (apply_new_text_length > 0) ? (w_text.Size - 1) : 0);
+                stb_textedit_replace(state, &state->Stb, w_text, w_text_len);
             }
         }
 